@@ -0,0 +1,62 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef TGUI_BENCHMARK_HPP
+#define TGUI_BENCHMARK_HPP
+
+#include <TGUI/Gui.hpp>
+
+#include <functional>
+#include <string>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace bench
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // A scene fills the gui with widgets. The size parameter controls how heavy the scene is (e.g. the amount of buttons).
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    struct Scene
+    {
+        std::string name;
+        std::size_t defaultSize;
+        std::function<void(tgui::Gui& gui, std::size_t size)> create;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Returns all scenes that can be benchmarked
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    const std::vector<Scene>& getScenes();
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Returns the amount of times that memory was allocated since the program was started
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    std::size_t getAllocationCount();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_BENCHMARK_HPP
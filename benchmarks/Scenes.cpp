@@ -0,0 +1,228 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "Benchmark.hpp"
+#include <TGUI/TGUI.hpp>
+
+#include <cmath>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace bench
+{
+    namespace
+    {
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Divides the view of the gui in cells so that the given amount of widgets fits inside it
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        struct GridPlacement
+        {
+            GridPlacement(const tgui::Gui& gui, std::size_t count) :
+                columns{std::max<std::size_t>(1, static_cast<std::size_t>(std::ceil(std::sqrt(static_cast<double>(count)))))},
+                cellSize{gui.getView().getSize().x / columns,
+                         gui.getView().getSize().y / std::max<std::size_t>(1, (count + columns - 1) / columns)}
+            {
+            }
+
+            sf::Vector2f getPosition(std::size_t index) const
+            {
+                return {(index % columns) * cellSize.x, (index / columns) * cellSize.y};
+            }
+
+            std::size_t columns;
+            sf::Vector2f cellSize;
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void createButtons(tgui::Gui& gui, std::size_t count)
+        {
+            const GridPlacement grid{gui, count};
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                auto button = tgui::Button::create("Button " + std::to_string(i));
+                button->setPosition(grid.getPosition(i));
+                button->setSize(grid.cellSize);
+                gui.add(button);
+            }
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void createLabels(tgui::Gui& gui, std::size_t count)
+        {
+            const GridPlacement grid{gui, count};
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                auto label = tgui::Label::create("Label " + std::to_string(i));
+                label->setPosition(grid.getPosition(i));
+                gui.add(label);
+            }
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void createNestedPanels(tgui::Gui& gui, std::size_t depth)
+        {
+            tgui::Container* parent = gui.getContainer().get();
+            for (std::size_t i = 0; i < depth; ++i)
+            {
+                auto panel = tgui::Panel::create({"100% - 2", "100% - 2"});
+                panel->setPosition(1, 1);
+                panel->getRenderer()->setBackgroundColor((i % 2) ? sf::Color{200, 200, 200} : sf::Color{100, 100, 100});
+                parent->add(panel);
+                parent = panel.get();
+            }
+
+            auto button = tgui::Button::create("Deepest");
+            parent->add(button);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void createListBox(tgui::Gui& gui, std::size_t itemCount)
+        {
+            auto listBox = tgui::ListBox::create();
+            listBox->setSize({"100%", "100%"});
+            for (std::size_t i = 0; i < itemCount; ++i)
+                listBox->addItem("Item " + std::to_string(i));
+
+            gui.add(listBox);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void createTextBox(tgui::Gui& gui, std::size_t lineCount)
+        {
+            sf::String text;
+            for (std::size_t i = 0; i < lineCount; ++i)
+                text += "Line " + std::to_string(i) + ": The quick brown fox jumps over the lazy dog.\n";
+
+            auto textBox = tgui::TextBox::create();
+            textBox->setSize({"100%", "100%"});
+            textBox->setText(text);
+            gui.add(textBox);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void createWrappedText(tgui::Gui& gui, std::size_t paragraphCount)
+        {
+            sf::String text;
+            for (std::size_t i = 0; i < paragraphCount; ++i)
+                text += "Paragraph " + std::to_string(i) + ": The quick brown fox jumps over the lazy dog, again and again until the line has to be wrapped.\n";
+
+            auto label = tgui::Label::create(text);
+            label->setSize({"50%", "50%"});
+            gui.add(label);
+
+            auto textBox = tgui::TextBox::create();
+            textBox->setPosition({"50%", 0});
+            textBox->setSize({"50%", "50%"});
+            textBox->setText(text);
+            gui.add(textBox);
+
+            auto chatBox = tgui::ChatBox::create();
+            chatBox->setPosition({0, "50%"});
+            chatBox->setSize({"100%", "50%"});
+            for (std::size_t i = 0; i < paragraphCount; ++i)
+                chatBox->addLine("Message " + std::to_string(i) + ": The quick brown fox jumps over the lazy dog, again and again until the line has to be wrapped.");
+            gui.add(chatBox);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void createThemedScreen(tgui::Gui& gui, std::size_t rowCount)
+        {
+            // The theme file has to be parsed again, otherwise only the first run would include the load time of the theme
+            tgui::DefaultThemeLoader::flushCache();
+            tgui::Theme theme{"resources/Black.txt"};
+
+            const float rowHeight = 30;
+            for (std::size_t i = 0; i < rowCount; ++i)
+            {
+                const float top = 5 + i * rowHeight;
+
+                auto label = tgui::Label::create("Row " + std::to_string(i));
+                label->setRenderer(theme.getRenderer("Label"));
+                label->setPosition(10, top);
+                gui.add(label);
+
+                auto button = tgui::Button::create("Button");
+                button->setRenderer(theme.getRenderer("Button"));
+                button->setPosition(80, top);
+                button->setSize(100, 25);
+                gui.add(button);
+
+                auto editBox = tgui::EditBox::create();
+                editBox->setRenderer(theme.getRenderer("EditBox"));
+                editBox->setPosition(190, top);
+                editBox->setSize(150, 25);
+                editBox->setDefaultText("Edit box");
+                gui.add(editBox);
+
+                auto checkBox = tgui::CheckBox::create("Check");
+                checkBox->setRenderer(theme.getRenderer("CheckBox"));
+                checkBox->setPosition(350, top);
+                checkBox->setSize(25, 25);
+                gui.add(checkBox);
+
+                auto slider = tgui::Slider::create();
+                slider->setRenderer(theme.getRenderer("Slider"));
+                slider->setPosition(450, top + 8);
+                slider->setSize(150, 10);
+                gui.add(slider);
+
+                auto comboBox = tgui::ComboBox::create();
+                comboBox->setRenderer(theme.getRenderer("ComboBox"));
+                comboBox->setPosition(620, top);
+                comboBox->setSize(150, 25);
+                comboBox->addItem("First");
+                comboBox->addItem("Second");
+                comboBox->setSelectedItemByIndex(0);
+                gui.add(comboBox);
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const std::vector<Scene>& getScenes()
+    {
+        static const std::vector<Scene> scenes = {
+            {"buttons", 1000, createButtons},
+            {"labels", 1000, createLabels},
+            {"nested-panels", 100, createNestedPanels},
+            {"listbox", 10000, createListBox},
+            {"textbox", 5000, createTextBox},
+            {"wrapped-text", 2000, createWrappedText},
+            {"theme", 15, createThemedScreen}
+        };
+
+        return scenes;
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
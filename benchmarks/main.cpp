@@ -0,0 +1,354 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "Benchmark.hpp"
+#include <TGUI/TGUI.hpp>
+#include <SFML/OpenGL.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <new>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Every allocation made by the program (including the ones inside tgui and sfml) is counted
+namespace
+{
+    std::atomic<std::size_t> allocationCount{0};
+}
+
+void* operator new(std::size_t size)
+{
+    ++allocationCount;
+    if (void* ptr = std::malloc(size ? size : 1))
+        return ptr;
+
+    throw std::bad_alloc{};
+}
+
+void* operator new[](std::size_t size)
+{
+    return operator new(size);
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace bench
+{
+    std::size_t getAllocationCount()
+    {
+        return allocationCount;
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+    struct Options
+    {
+        std::string scene;
+        std::size_t size = 0;
+        unsigned int frames = 100;
+        unsigned int events = 1000;
+        unsigned int resizes = 20;
+        sf::Vector2u targetSize{800, 600};
+        bool batching = false;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    double toMilliseconds(Clock::duration duration)
+    {
+        return std::chrono::duration<double, std::milli>(duration).count();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void drawFrame(sf::RenderTexture& target, tgui::Gui& gui)
+    {
+        target.clear();
+        gui.draw();
+        target.display();
+
+        // Wait until the frame has really been rendered, otherwise only the time to queue the gl commands would be measured
+        glFinish();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    // Moves the mouse over the whole target and clicks every now and then
+    sf::Event createEvent(unsigned int index, sf::Vector2u targetSize)
+    {
+        const unsigned int columns = 40;
+        const unsigned int rows = 30;
+        const int x = static_cast<int>(((index * 7) % columns) * targetSize.x / columns);
+        const int y = static_cast<int>(((index / columns) % rows) * targetSize.y / rows);
+
+        sf::Event event;
+        if (index % 10 == 8)
+        {
+            event.type = sf::Event::MouseButtonPressed;
+            event.mouseButton = {sf::Mouse::Left, x, y};
+        }
+        else if (index % 10 == 9)
+        {
+            event.type = sf::Event::MouseButtonReleased;
+            event.mouseButton = {sf::Mouse::Left, x, y};
+        }
+        else
+        {
+            event.type = sf::Event::MouseMoved;
+            event.mouseMove = {x, y};
+        }
+
+        return event;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void runScene(const bench::Scene& scene, const Options& options)
+    {
+        const std::size_t size = options.size ? options.size : scene.defaultSize;
+
+        sf::RenderTexture target;
+        if (!target.create(options.targetSize.x, options.targetSize.y))
+            throw tgui::Exception{"Failed to create render texture"};
+
+        tgui::Gui gui{target};
+        gui.setDrawBatching(options.batching);
+        gui.setRenderStatisticsEnabled(true);
+
+        // Load the scene
+        std::size_t allocations = bench::getAllocationCount();
+        Clock::time_point start = Clock::now();
+        scene.create(gui, size);
+        const double loadTime = toMilliseconds(Clock::now() - start);
+        const std::size_t loadAllocations = bench::getAllocationCount() - allocations;
+
+        // The first frame creates glyphs and other lazily loaded resources, so it isn't part of the measurements
+        drawFrame(target, gui);
+
+        std::vector<double> frameTimes;
+        frameTimes.reserve(options.frames);
+        allocations = bench::getAllocationCount();
+        for (unsigned int i = 0; i < options.frames; ++i)
+        {
+            start = Clock::now();
+            drawFrame(target, gui);
+            frameTimes.push_back(toMilliseconds(Clock::now() - start));
+        }
+        const std::size_t frameAllocations = bench::getAllocationCount() - allocations;
+        const tgui::RenderStatistics frameStatistics = gui.getRenderStatistics();
+
+        allocations = bench::getAllocationCount();
+        start = Clock::now();
+        for (unsigned int i = 0; i < options.events; ++i)
+            gui.handleEvent(createEvent(i, options.targetSize));
+        const double eventTime = toMilliseconds(Clock::now() - start);
+        const std::size_t eventAllocations = bench::getAllocationCount() - allocations;
+
+        // Changing the size of the view resizes the widgets with relative sizes, which causes their text to be wrapped again
+        allocations = bench::getAllocationCount();
+        start = Clock::now();
+        for (unsigned int i = 0; i < options.resizes; ++i)
+        {
+            const float scale = (i % 2 == 0) ? 0.9f : 1.f;
+            gui.setView(sf::View{{0, 0, options.targetSize.x * scale, options.targetSize.y * scale}});
+        }
+        const double resizeTime = toMilliseconds(Clock::now() - start);
+        const std::size_t resizeAllocations = bench::getAllocationCount() - allocations;
+
+        double frameTimeMean = 0;
+        double frameTimeMedian = 0;
+        double frameTimeMax = 0;
+        if (!frameTimes.empty())
+        {
+            for (const double time : frameTimes)
+                frameTimeMean += time;
+            frameTimeMean /= frameTimes.size();
+
+            std::sort(frameTimes.begin(), frameTimes.end());
+            frameTimeMedian = frameTimes[frameTimes.size() / 2];
+            frameTimeMax = frameTimes.back();
+        }
+
+        // Print the results as a single json object per line
+        std::cout << std::fixed << std::setprecision(4)
+                  << "{\"scene\": \"" << scene.name << "\""
+                  << ", \"size\": " << size
+                  << ", \"batching\": " << (options.batching ? "true" : "false")
+                  << ", \"load_ms\": " << loadTime
+                  << ", \"load_allocations\": " << loadAllocations
+                  << ", \"frames\": " << options.frames
+                  << ", \"frame_ms_mean\": " << frameTimeMean
+                  << ", \"frame_ms_median\": " << frameTimeMedian
+                  << ", \"frame_ms_max\": " << frameTimeMax
+                  << ", \"frame_allocations\": " << (options.frames ? static_cast<double>(frameAllocations) / options.frames : 0.0)
+                  << ", \"draw_calls\": " << frameStatistics.drawCalls
+                  << ", \"vertices\": " << frameStatistics.vertices
+                  << ", \"texture_switches\": " << frameStatistics.textureSwitches
+                  << ", \"scissor_changes\": " << frameStatistics.scissorChanges
+                  << ", \"widgets_visited\": " << frameStatistics.widgetsVisited
+                  << ", \"widgets_culled\": " << frameStatistics.widgetsCulled
+                  << ", \"events\": " << options.events
+                  << ", \"event_us_mean\": " << (options.events ? eventTime * 1000 / options.events : 0.0)
+                  << ", \"event_allocations\": " << (options.events ? static_cast<double>(eventAllocations) / options.events : 0.0)
+                  << ", \"resizes\": " << options.resizes
+                  << ", \"resize_ms_mean\": " << (options.resizes ? resizeTime / options.resizes : 0.0)
+                  << ", \"resize_allocations\": " << (options.resizes ? static_cast<double>(resizeAllocations) / options.resizes : 0.0)
+                  << "}" << std::endl;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void printUsage()
+    {
+        std::cerr << "Usage: tgui-bench [options]\n"
+                     "  --scene NAME      Only run the given scene (default: all scenes)\n"
+                     "  --size N          Amount of widgets, items or lines in the scene (default: depends on scene)\n"
+                     "  --frames N        Amount of frames to measure (default: 100)\n"
+                     "  --events N        Amount of events to measure (default: 1000)\n"
+                     "  --resizes N       Amount of times to resize the gui (default: 20)\n"
+                     "  --target WxH      Size of the render texture (default: 800x600)\n"
+                     "  --batching        Enable draw batching in the gui\n"
+                     "  --hardware        Don't request software rendering from the opengl driver\n"
+                     "  --list            Print the names of the scenes\n"
+                     "Every scene prints one json object per line to the standard output.\n";
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+int main(int argc, char* argv[])
+{
+    Options options;
+    bool softwareRendering = true;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        const std::string arg = argv[i];
+        const bool hasValue = (i + 1 < argc);
+
+        if ((arg == "--scene") && hasValue)
+            options.scene = argv[++i];
+        else if ((arg == "--size") && hasValue)
+            options.size = std::stoul(argv[++i]);
+        else if ((arg == "--frames") && hasValue)
+            options.frames = std::stoul(argv[++i]);
+        else if ((arg == "--events") && hasValue)
+            options.events = std::stoul(argv[++i]);
+        else if ((arg == "--resizes") && hasValue)
+            options.resizes = std::stoul(argv[++i]);
+        else if ((arg == "--target") && hasValue)
+        {
+            const std::string value = argv[++i];
+            const auto separator = value.find('x');
+            if (separator == std::string::npos)
+            {
+                printUsage();
+                return 1;
+            }
+
+            options.targetSize = {static_cast<unsigned int>(std::stoul(value.substr(0, separator))),
+                                  static_cast<unsigned int>(std::stoul(value.substr(separator + 1)))};
+        }
+        else if (arg == "--batching")
+            options.batching = true;
+        else if (arg == "--hardware")
+            softwareRendering = false;
+        else if (arg == "--list")
+        {
+            for (const auto& scene : bench::getScenes())
+                std::cout << scene.name << std::endl;
+            return 0;
+        }
+        else
+        {
+            printUsage();
+            return 1;
+        }
+    }
+
+#ifdef SFML_SYSTEM_LINUX
+    // Ask mesa for its software rasterizer so that the results don't depend on the gpu, unless the variable was already set
+    if (softwareRendering)
+        setenv("LIBGL_ALWAYS_SOFTWARE", "1", 0);
+#endif
+
+    bool sceneFound = false;
+    try
+    {
+        for (const auto& scene : bench::getScenes())
+        {
+            if (!options.scene.empty() && (scene.name != options.scene))
+                continue;
+
+            sceneFound = true;
+            runScene(scene, options);
+        }
+    }
+    catch (const tgui::Exception& e)
+    {
+        std::cerr << "TGUI Exception: " << e.what() << std::endl;
+        return 1;
+    }
+
+    if (!sceneFound)
+    {
+        std::cerr << "Unknown scene: " << options.scene << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
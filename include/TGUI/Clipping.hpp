@@ -27,14 +27,120 @@
 #define TGUI_CLIPPING_HPP
 
 #include <TGUI/Global.hpp>
+#include <TGUI/DrawBatch.hpp>
 #include <SFML/Graphics/RenderTarget.hpp>
 #include <SFML/Graphics/View.hpp>
-#include <SFML/OpenGL.hpp>
+#include <SFML/Graphics/Rect.hpp>
+#include <memory>
+#include <vector>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
 {
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Stack of clipping areas on a render target
+    ///
+    /// The gui starts a stack when it draws and the clipping objects created while drawing push their area to it. The current
+    /// scissor box is tracked on the cpu, so no opengl state has to be read back and glScissor is only called when the
+    /// clipping area actually changes.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API ClippingStack
+    {
+    public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Default constructor
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ClippingStack() = default;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // The stack cannot be copied
+        ClippingStack(const ClippingStack& copy) = delete;
+        ClippingStack& operator=(const ClippingStack& right) = delete;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Enables clipping on the target and makes this the active stack of the target
+        ///
+        /// @param target  Target to which is going to be drawn, its opengl context has to be active
+        ///
+        /// The whole target is visible until a clipping object is created.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void begin(const sf::RenderTarget& target);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Disables clipping again and makes the stack that was active before the call to begin active again
+        ///
+        /// When that stack belonged to a different target, you should call restore on it once the context of its target
+        /// has been activated again.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void end();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Reapplies the current clipping area, which is needed after drawing to another target using the same context
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void restore();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Adds a clipping area to the stack
+        ///
+        /// @param area  Area in pixels, with the origin in the top left corner of the target
+        ///
+        /// The area is intersected with the current clipping area.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void push(sf::IntRect area);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Removes the last clipping area from the stack
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void pop();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the current clipping area
+        ///
+        /// @return Area in pixels, with the origin in the top left corner of the target
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const sf::IntRect& getArea() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the active stack of a render target
+        ///
+        /// @param target  Target to which is being drawn
+        ///
+        /// @return Stack that is being used to draw on the target, or nullptr when nothing is being drawn to it
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static ClippingStack* getActive(const sf::RenderTarget& target);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Calls glScissor when the current area differs from the one that was last passed to opengl
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void apply(bool force);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        const sf::RenderTarget* m_target = nullptr;
+        ClippingStack* m_previousStack = nullptr;
+        std::vector<sf::IntRect> m_areas;
+        sf::IntRect m_appliedArea;
+
+        static ClippingStack* m_activeStack;
+    };
+
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     class TGUI_API Clipping
@@ -49,30 +155,10 @@ namespace tgui
         /// @param topLeft Position of the top left corner of the clipping area relative to the view
         /// @param size    Size of the clipping area relative to the view
         ///
+        /// The area is pushed on the active clipping stack of the target. When the target has no active stack (because the
+        /// widget isn't being drawn by the gui), a stack is started for the lifetime of the clipping object.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        Clipping(const sf::RenderTarget& target, const sf::RenderStates& states, sf::Vector2f topLeft, sf::Vector2f size)
-        {
-            const sf::Vector2i topLeftPosition = target.mapCoordsToPixel(states.transform.transformPoint(topLeft));
-            const sf::Vector2i bottomRightPosition = target.mapCoordsToPixel(states.transform.transformPoint(topLeft + size));
-
-            // Get the old clipping area
-            glGetIntegerv(GL_SCISSOR_BOX, m_scissor);
-
-            // Calculate the clipping area
-            const GLint scissorLeft = std::max(static_cast<GLint>(topLeftPosition.x), m_scissor[0]);
-            const GLint scissorBottom = std::min(static_cast<GLint>(bottomRightPosition.y), static_cast<GLint>(target.getSize().y) - m_scissor[1]);
-            GLint scissorTop = std::max(static_cast<GLint>(topLeftPosition.y), static_cast<GLint>(target.getSize().y) - m_scissor[1] - m_scissor[3]);
-            GLint scissorRight = std::min(static_cast<GLint>(bottomRightPosition.x), m_scissor[0] + m_scissor[2]);
-
-            // If the object outside the window then don't draw anything
-            if (scissorRight < scissorLeft)
-                scissorRight = scissorLeft;
-            else if (scissorBottom < scissorTop)
-                scissorTop = scissorBottom;
-
-            // Set the clipping area
-            glScissor(scissorLeft, target.getSize().y - scissorBottom, scissorRight - scissorLeft, scissorBottom - scissorTop);
-        }
+        Clipping(const sf::RenderTarget& target, const sf::RenderStates& states, sf::Vector2f topLeft, sf::Vector2f size);
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -83,16 +169,28 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
         // When the clipping object is destroyed, the old clipping is restored
-        ~Clipping()
-        {
-            glScissor(m_scissor[0], m_scissor[1], m_scissor[2], m_scissor[3]);
-        };
+        ~Clipping();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Checks whether an area could be visible with the current clipping
+        ///
+        /// @param target  Target to which we are drawing
+        /// @param states  Current render states
+        /// @param area    Area relative to the view that is about to be drawn
+        ///
+        /// @return False when the area lies completely outside the current clipping area, true otherwise
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static bool isVisible(const sf::RenderTarget& target, const sf::RenderStates& states, const sf::FloatRect& area);
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
 
-        GLint m_scissor[4] = {};
+        const sf::RenderTarget& m_target;
+        ClippingStack* m_stack;
+        std::unique_ptr<ClippingStack> m_ownStack;
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -28,8 +28,10 @@
 
 
 #include <list>
+#include <unordered_map>
 
 #include <TGUI/Widget.hpp>
+#include <SFML/Graphics/RenderTexture.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -138,11 +140,15 @@ namespace tgui
         /// @brief Returns a pointer to an earlier created widget
         ///
         /// @param widgetName The name that was given to the widget when it was added to the container
-        /// @param recursive  Should the function also search for widgets inside containers that are inside this container?
         ///
         /// The container will first search for widgets that are direct children of it, but when none of the child widgets match
         /// the given name, a recursive search will be performed.
         ///
+        /// Every container keeps a hash table with the names of all widgets inside it, so the lookup doesn't have to visit the
+        /// child widgets. When no widget has the exact name, the name is treated as a path separated by dots (e.g.
+        /// "SettingsPanel.Audio.Volume"): the first part is searched like any other name and every next part has to be the name
+        /// of a direct child of the widget found so far.
+        ///
         /// @return Pointer to the earlier created widget
         ///
         /// @warning This function will return nullptr when an unknown widget name was passed
@@ -155,13 +161,12 @@ namespace tgui
         /// @brief Returns a pointer to an earlier created widget
         ///
         /// @param widgetName The name that was given to the widget when it was added to the container
-        /// @param recursive  Should the function also search for widgets inside containers that are inside this container?
         ///
         /// @return Pointer to the earlier created widget.
         ///         The pointer will already be casted to the desired type
         ///
         /// The container will first search for widgets that are direct children of it, but when none of the child widgets match
-        /// the given name, a recursive search will be performed.
+        /// the given name, a recursive search will be performed. Paths like "SettingsPanel.Audio.Volume" are also accepted.
         ///
         /// @warning This function will return nullptr when an unknown widget name was passed
         ///
@@ -259,6 +264,37 @@ namespace tgui
         void uncheckRadioButtons();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether the child widgets are drawn to an offscreen texture which is reused in the next frames
+        ///
+        /// @param cached  Should the contents of the container be cached?
+        ///
+        /// When the layer is cached, the child widgets are only drawn again when one of them changes (see Widget::invalidate).
+        /// In all other frames, the container is drawn as a single textured quad. This is useful for containers whose
+        /// contents rarely change. Caching is disabled by default.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setLayerCached(bool cached = true);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the child widgets are drawn to an offscreen texture which is reused in the next frames
+        ///
+        /// @return Are the contents of the container cached?
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isLayerCached() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Informs the container and its parents that the container has to be redrawn
+        ///
+        /// The cached layer of the container is drawn again the next time the container is drawn.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void invalidate() override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns the size available for child widgets
         ///
@@ -422,6 +458,12 @@ namespace tgui
         virtual void update(sf::Time elapsedTime) override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the shortest time until the container or one of its visible widgets changes by itself.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual sf::Time timeUntilNextUpdate() const override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // When this function is called then all the widgets receive the event (if there are widgets).
         // The function returns true when the event is consumed and false when the event was ignored by all widgets.
@@ -451,26 +493,111 @@ namespace tgui
         Widget::Ptr mouseOnWhichWidget(sf::Vector2f mousePos);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Divides the area covered by the visible child widgets in cells and stores which widgets overlap with each cell.
+        // The grid is rebuilt lazily when mouseOnWhichWidget needs it after the child widgets were moved, resized, shown,
+        // hidden, added, removed or reordered.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void rebuildHitTestGrid();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Adds or removes a widget and all named widgets inside it to or from the name index of this container and its parents
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateNameIndex(Widget* widget, const sf::String& widgetName, bool added);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Adds or removes all named widgets inside this container to or from the name index of the parents of this container
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateNameIndexOfParents(bool added);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Adds or removes a single entry to or from the name index of this container and its parents
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void changeNameIndexEntry(const std::string& key, Widget* widget, bool added);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns whether the recursive search would find the left widget before the right one. Both widgets have to be
+        // located inside this container.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isBeforeInTreeOrder(const Widget* left, const Widget* right) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Has to be called after the widget at the given index was moved there from another index, so that the name index
+        // stays sorted in the order in which the recursive search would find the widgets
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateWidgetOrder(std::size_t index);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the first direct child with the given name, or nullptr when no child has this name
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Widget* getDirectChild(const std::string& key) const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // This function will call the draw function from all the widgets.
+        // When the layer is cached, the widgets are drawn to the layer texture first if something changed since the last time.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         virtual void drawWidgetContainer(sf::RenderTarget* target, const sf::RenderStates& states = sf::RenderStates::Default) const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Redraws the child widgets to the layer texture when needed and draws the layer to the target.
+        // Returns false when the layer texture couldn't be created, in which case nothing was drawn.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool drawCachedLayer(sf::RenderTarget& target, const sf::RenderStates& states) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Draws the visible child widgets that aren't located outside the clipping area
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void drawChildWidgets(sf::RenderTarget& target, const sf::RenderStates& states) const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
         std::vector<Widget::Ptr> m_widgets;
         std::vector<sf::String>  m_widgetNames;
 
+        // All named widgets inside this container (also inside its child containers), by their name in UTF-8
+        std::unordered_map<std::string, std::vector<Widget*>> m_nameIndex;
+
         Widget::Ptr m_widgetBelowMouse;
 
+        // The widget on which the left mouse button last went down. It receives the mouse move events while it is being dragged
+        // and is the only child that gets told when the mouse goes up, which it passes on to its own child widgets.
+        Widget::Ptr m_widgetWithLeftMouseDown;
+
         // The id of the focused widget
         std::size_t m_focusedWidget = 0;
 
         // Did we enter handleEvent directly or because we got a MouseReleased event?
         bool m_handingMouseReleased = false;
 
+        // Offscreen texture in which the child widgets are drawn when the layer is cached
+        bool m_layerCached = false;
+        mutable bool m_layerInvalid = true;
+        mutable std::unique_ptr<sf::RenderTexture> m_layerTexture;
+        mutable sf::Vector2f m_layerSize;
+
+        // Uniform grid over the child widgets, used to find the widget below the mouse when there are many child widgets
+        bool m_hitTestGridValid = false;
+        sf::Vector2f m_hitTestGridOrigin;
+        sf::Vector2f m_hitTestCellSize;
+        std::size_t m_hitTestColumns = 0;
+        std::size_t m_hitTestRows = 0;
+        std::vector<std::size_t> m_hitTestCellStarts; // Where the widgets of each cell start in m_hitTestCellWidgets
+        std::vector<std::size_t> m_hitTestCellWidgets; // Indices of the widgets overlapping with each cell, from back to front
+        std::vector<std::size_t> m_hitTestUnboundedWidgets; // Widgets that have to be checked for every mouse position
+
+        friend class Widget; // Widgets tell their parent when the area on which they can be clicked changes
+
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     };
@@ -517,6 +644,15 @@ namespace tgui
         virtual bool mouseOnWidget(sf::Vector2f pos) const override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Marks the gui as needing to be redrawn
+        ///
+        /// @see Gui::needsRedraw
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void invalidate() override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
 
@@ -541,6 +677,9 @@ namespace tgui
 
         friend class Gui; // Required to let Gui access protected members from container and Widget
 
+        // Did something change since the gui was last drawn?
+        bool m_redrawNeeded = true;
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     };
 
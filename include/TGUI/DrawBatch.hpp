@@ -0,0 +1,174 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef TGUI_DRAW_BATCH_HPP
+#define TGUI_DRAW_BATCH_HPP
+
+#include <TGUI/Global.hpp>
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/RenderStates.hpp>
+#include <SFML/Graphics/Drawable.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+#include <SFML/Graphics/Shape.hpp>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Collects the geometry drawn by widgets into as few draw calls as possible
+    ///
+    /// While a DrawBatch object exists, triangle geometry that is drawn via the static draw functions of this class to the
+    /// target of the batch is not sent to the render target immediately. Instead it is transformed on the cpu and appended to
+    /// a single vertex array, which is only drawn when the texture, blend mode or shader changes, when the clipping area
+    /// changes or when the batch object is destroyed.
+    ///
+    /// When no batch is active for the target, the draw functions simply draw directly to the target.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API DrawBatch
+    {
+    public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Starts batching everything that is drawn to the target until the object is destroyed
+        ///
+        /// @param target  Target to which we are drawing
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        DrawBatch(sf::RenderTarget& target);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // The batch object cannot be copied
+        DrawBatch(const DrawBatch& copy) = delete;
+        DrawBatch& operator=(const DrawBatch& right) = delete;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // When the batch object is destroyed, the remaining geometry is drawn and the previous batch becomes active again
+        ~DrawBatch();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Draws vertices to the target, or adds them to the active batch of the target
+        ///
+        /// @param target       Target to which we are drawing
+        /// @param vertices     Pointer to the vertices
+        /// @param vertexCount  Number of vertices in the array
+        /// @param type         Type of primitives to draw
+        /// @param states       Render states to use for drawing
+        ///
+        /// Only sf::Triangles, sf::TrianglesStrip and sf::TrianglesFan can be batched, other primitive types are drawn directly.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void draw(sf::RenderTarget& target, const sf::Vertex* vertices, std::size_t vertexCount, sf::PrimitiveType type,
+                         const sf::RenderStates& states = sf::RenderStates::Default);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Draws a shape to the target, or adds it to the active batch of the target
+        ///
+        /// @param target  Target to which we are drawing
+        /// @param shape   The shape to draw
+        /// @param states  Render states to use for drawing
+        ///
+        /// Only shapes without texture and without outline are batched, other shapes are drawn directly.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void draw(sf::RenderTarget& target, const sf::Shape& shape, const sf::RenderStates& states = sf::RenderStates::Default);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Draws an arbitrary drawable object to the target
+        ///
+        /// @param target    Target to which we are drawing
+        /// @param drawable  Object to draw
+        /// @param states    Render states to use for drawing
+        ///
+        /// The geometry of the drawable can't be inspected, so the active batch is flushed before drawing the object directly.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void draw(sf::RenderTarget& target, const sf::Drawable& drawable, const sf::RenderStates& states = sf::RenderStates::Default);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Draws the geometry that was already collected for the target
+        ///
+        /// @param target  Target to which we are drawing
+        ///
+        /// This function has to be called before changing any render state that isn't part of sf::RenderStates (e.g. the
+        /// scissor box). It does nothing when no batch is active for the target.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void flush(const sf::RenderTarget& target);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether draw calls to the given target are currently being batched
+        ///
+        /// @param target  Target to which we are drawing
+        ///
+        /// @return Is there an active batch for the target?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static bool isBatching(const sf::RenderTarget& target);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the active batch if it belongs to the given target
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static DrawBatch* getBatch(const sf::RenderTarget& target);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Makes sure the batch can accept geometry with the given states, flushing the batch first when needed
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void prepare(const sf::RenderStates& states);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Draws the collected vertices and clears the batch
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void flushBatch();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        sf::RenderTarget& m_target;
+        DrawBatch* m_previousBatch;
+
+        std::vector<sf::Vertex> m_vertices;
+        const sf::Texture* m_texture = nullptr;
+        const sf::Shader* m_shader = nullptr;
+        sf::BlendMode m_blendMode;
+
+        static DrawBatch* m_activeBatch;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_DRAW_BATCH_HPP
@@ -182,6 +182,21 @@ namespace tgui
         float getLineSpacing(unsigned int characterSize) const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Renders glyphs in advance, so that this doesn't have to happen the first time they are drawn
+        ///
+        /// @param characters     Characters to render, the printable ascii characters are used when the string is empty
+        /// @param characterSize  Size of the characters
+        /// @param bold           Render the bold version of the characters or the regular one?
+        ///
+        /// A glyph is normally only rendered and added to the texture of the font when it is needed for the first time.
+        /// Calling this function e.g. while a loading screen is shown prevents this work from happening in the middle of
+        /// an interaction.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void preloadGlyphs(const sf::String& characters, unsigned int characterSize, bool bold = false) const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
 
@@ -0,0 +1,124 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef TGUI_FONT_MANAGER_HPP
+#define TGUI_FONT_MANAGER_HPP
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <TGUI/Config.hpp>
+#include <SFML/Graphics/Font.hpp>
+#include <memory>
+#include <string>
+#include <map>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    class TGUI_API FontManager
+    {
+    public:
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Loads a font
+        ///
+        /// @param filename  Filename of the font to load
+        ///
+        /// As long as the returned font is still being used somewhere, calling this function again with the same file will
+        /// return the same font instead of loading it a second time. Different spellings of the same path (e.g. "a/./b.ttf"
+        /// and "a/b.ttf") are recognized as the same file.
+        ///
+        /// @return The loaded font, or nullptr when the file could not be loaded
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::shared_ptr<sf::Font> getFont(const std::string& filename);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the font that is built into tgui
+        ///
+        /// The font is only loaded the first time this function is called. As long as the font is still being used (e.g. by
+        /// a gui), all calls return the same font, so all guis share its glyph cache. Keep a copy of the returned pointer if
+        /// guis are created and destroyed one after another and the font should not be loaded again each time.
+        ///
+        /// @return The default font, or nullptr when it could not be loaded
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::shared_ptr<sf::Font> getDefaultFont();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether fonts are loaded by mapping the file into memory
+        ///
+        /// @param enabled  Should new fonts be loaded from a memory-mapped file?
+        ///
+        /// Instead of letting FreeType read the file, the file can be mapped into memory. The font data is then shared with
+        /// other processes using the same file and only the parts that are actually needed are read from disk.
+        /// When the file can't be mapped, the font is loaded in the normal way. This option is disabled by default.
+        ///
+        /// The file stays mapped until the returned font is destroyed, so copies of the sf::Font must not outlive it.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void setMemoryMappingEnabled(bool enabled);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether fonts are loaded by mapping the file into memory
+        ///
+        /// @return Are new fonts loaded from a memory-mapped file?
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static bool isMemoryMappingEnabled();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Returns the normalized version of a path that is used to recognize the same file
+        ///
+        /// @param filename  Path to normalize
+        ///
+        /// @return Path with backslashes replaced, redundant slashes and "." parts removed and ".." parts resolved
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::string normalizePath(const std::string& filename);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    protected:
+
+        static std::map<std::string, std::weak_ptr<sf::Font>> m_fonts;
+        static std::weak_ptr<sf::Font> m_defaultFont;
+        static bool m_memoryMappingEnabled;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_FONT_MANAGER_HPP
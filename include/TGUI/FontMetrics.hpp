@@ -0,0 +1,171 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef TGUI_FONT_METRICS_HPP
+#define TGUI_FONT_METRICS_HPP
+
+#include <TGUI/Config.hpp>
+#include <SFML/Graphics/Font.hpp>
+#include <unordered_map>
+#include <memory>
+#include <bitset>
+#include <array>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Cached measurements of a font at a certain character size
+    ///
+    /// Measuring text requires the advance of every character and the kerning between every pair of characters. Asking these
+    /// to the font each time involves several lookups in the glyph tables of the font (and sometimes rendering the glyph), so
+    /// the values are remembered here once they have been requested.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API FontMetrics
+    {
+    public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the metrics of a font
+        ///
+        /// @param font           Font to measure, must not be a nullptr
+        /// @param characterSize  Size of the characters
+        /// @param bold           Measure the bold version of the characters or the regular one?
+        ///
+        /// @return Metrics that stay valid for as long as the font exists
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static const FontMetrics& get(const std::shared_ptr<sf::Font>& font, unsigned int characterSize, bool bold);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Forgets all metrics of a font
+        ///
+        /// @param font  Font of which the metrics are no longer correct
+        ///
+        /// This only has to be called when a different font file was loaded in an sf::Font that was already being used.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void invalidate(const sf::Font& font);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the horizontal offset to the next character
+        ///
+        /// @param codePoint  Unicode code point of the character
+        ///
+        /// @return Advance of the glyph, in pixels
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        float getAdvance(sf::Uint32 codePoint) const
+        {
+            if ((codePoint < DenseRangeSize) && m_denseAdvancesCached[codePoint])
+                return m_denseAdvances[codePoint];
+            else
+                return loadAdvance(codePoint);
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the kerning offset of two glyphs
+        ///
+        /// @param first   Unicode code point of the first character
+        /// @param second  Unicode code point of the second character
+        ///
+        /// @return Kerning value for @a first and @a second, in pixels
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        float getKerning(sf::Uint32 first, sf::Uint32 second) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the vertical offset between two consecutive lines of text
+        ///
+        /// @return Line spacing, in pixels
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        float getLineSpacing() const
+        {
+            return m_lineSpacing;
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the space that is needed below the last line of text in addition to the line spacing
+        ///
+        /// @return Value that Text::calculateExtraVerticalSpace returns for this font and character size
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        float getExtraVerticalSpace() const
+        {
+            return m_extraVerticalSpace;
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        // The metrics are only created by the get function
+        FontMetrics(const sf::Font& font, unsigned int characterSize, bool bold);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Asks the advance of a glyph to the font and stores it
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        float loadAdvance(sf::Uint32 codePoint) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        // The code points below this value (ascii and latin-1) are stored in an array instead of in a map
+        static constexpr std::size_t DenseRangeSize = 256;
+
+        // The kerning between printable ascii characters is stored in a table instead of in a map
+        static constexpr sf::Uint32 KerningTableFirst = 32;
+        static constexpr sf::Uint32 KerningTableSize = 96;
+
+        const sf::Font& m_font;
+        const unsigned int m_characterSize;
+        const bool m_bold;
+
+        float m_lineSpacing = 0;
+        float m_extraVerticalSpace = 0;
+
+        mutable std::array<float, DenseRangeSize> m_denseAdvances = {{}};
+        mutable std::bitset<DenseRangeSize> m_denseAdvancesCached;
+        mutable std::unordered_map<sf::Uint32, float> m_advances;
+        mutable std::vector<float> m_kerningTable; // Created on first use, NaN for pairs that haven't been asked yet
+        mutable std::unordered_map<sf::Uint64, float> m_kernings;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_FONT_METRICS_HPP
@@ -28,6 +28,8 @@
 
 
 #include <TGUI/Container.hpp>
+#include <TGUI/Clipping.hpp>
+#include <TGUI/RenderStatistics.hpp>
 #include <SFML/Graphics/RenderWindow.hpp>
 #include <queue>
 
@@ -141,10 +143,38 @@ namespace tgui
         ///
         /// You should call this function in your event loop.
         ///
+        /// When event queueing is enabled, the event is only stored and this function always returns false.
+        ///
+        /// @see setEventQueueing
+        ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         bool handleEvent(sf::Event event);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether events passed to handleEvent are queued until the gui is updated
+        ///
+        /// @param queued  Should events be stored and only be passed to the widgets on the next call to draw or updateTime?
+        ///
+        /// A high polling rate mouse or a touch screen can generate hundreds of move events per frame. When queueing is enabled,
+        /// consecutive MouseMoved events and consecutive TouchMoved events of the same finger are merged into a single event,
+        /// while all other events keep their order. The widgets thus only see the last mouse position before each click, key
+        /// press or text event. The drawback is that handleEvent can no longer tell whether the event was consumed.
+        ///
+        /// Queueing is disabled by default. Events that are still queued when it gets disabled are handled immediately.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setEventQueueing(bool queued = true);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether events passed to handleEvent are queued until the gui is updated
+        ///
+        /// @return Are events stored until the next call to draw or updateTime?
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isEventQueueingEnabled() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Draws all the widgets that were added to the gui
         ///
@@ -152,6 +182,47 @@ namespace tgui
         void draw();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the gui looks different than the last time it was drawn
+        ///
+        /// @return Has something changed since the last call to draw, or is an animation, caret or tool tip due?
+        ///
+        /// Widgets report their own changes, e.g. when an event changed their state or when a renderer property was changed.
+        /// Together with timeUntilNextUpdate, this lets you skip drawing while the gui is idle:
+        /// @code
+        /// while (window.isOpen())
+        /// {
+        ///     sf::Event event;
+        ///     while (window.pollEvent(event))
+        ///         gui.handleEvent(event);
+        ///
+        ///     if (gui.needsRedraw())
+        ///     {
+        ///         window.clear();
+        ///         gui.draw();
+        ///         window.display();
+        ///     }
+        ///     else // Sleep until the next event or until something is scheduled to change, whichever comes first
+        ///         sf::sleep(std::min(gui.timeUntilNextUpdate(), sf::milliseconds(10)));
+        /// }
+        /// @endcode
+        ///
+        /// Changes made outside the gui (e.g. the rest of your scene) are of course not detected.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool needsRedraw() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns how long it takes before the gui changes by itself
+        ///
+        /// @return Time until the next animation step, caret blink or tool tip. This is 0 while an animation is playing and it
+        ///         is the largest representable time when nothing is scheduled.
+        ///
+        /// The time is calculated relative to the current time, so it keeps decreasing when draw isn't being called.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        sf::Time timeUntilNextUpdate() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns the internal container of the Gui
         ///
@@ -218,12 +289,12 @@ namespace tgui
         /// @brief Returns a pointer to an earlier created widget
         ///
         /// @param widgetName The name that was given to the widget when it was added to the container
-        /// @param recursive  Should the function also search for widgets inside containers that are inside this container?
         ///
         /// @return Pointer to the earlier created widget
         ///
         /// The gui will first search for widgets that are direct children of it, but when none of the child widgets match
-        /// the given name, a recursive search will be performed.
+        /// the given name, a recursive search will be performed. Paths like "SettingsPanel.Audio.Volume" are also accepted,
+        /// see Container::get for details.
         ///
         /// @warning This function will return nullptr when an unknown widget name was passed
         ///
@@ -235,13 +306,13 @@ namespace tgui
         /// @brief Returns a pointer to an earlier created widget
         ///
         /// @param widgetName The name that was given to the widget when it was added to the container
-        /// @param recursive  Should the function also search for widgets inside containers that are inside this container?
         ///
         /// @return Pointer to the earlier created widget.
         ///         The pointer will already be casted to the desired type
         ///
         /// The gui will first search for widgets that are direct children of it, but when none of the child widgets match
-        /// the given name, a recursive search will be performed.
+        /// the given name, a recursive search will be performed. Paths like "SettingsPanel.Audio.Volume" are also accepted,
+        /// see Container::get for details.
         ///
         /// @warning This function will return nullptr when an unknown widget name was passed
         ///
@@ -355,6 +426,58 @@ namespace tgui
         float getOpacity() const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether the geometry of the widgets is batched together when drawing the gui
+        ///
+        /// @param batched  Should the draw function combine widgets into as few draw calls as possible?
+        ///
+        /// When batching is enabled, consecutive triangles that share the same texture are collected on the cpu and sent to the
+        /// render target in a single draw call. Every clipping area and every change of texture breaks the batch.
+        /// The result looks identical, but drawing screens with many widgets becomes a lot cheaper.
+        ///
+        /// Batching is disabled by default.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setDrawBatching(bool batched = true);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the geometry of the widgets is batched together when drawing the gui
+        ///
+        /// @return Are the widgets combined into as few draw calls as possible?
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isDrawBatchingEnabled() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether statistics are collected while drawing the gui
+        ///
+        /// @param enabled  Should the draw function count draw calls, vertices, clipping changes and widgets?
+        ///
+        /// The statistics of the last frame can be retrieved with getRenderStatistics after calling the draw function.
+        /// Collecting the statistics is cheap, but it is disabled by default.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setRenderStatisticsEnabled(bool enabled = true);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether statistics are collected while drawing the gui
+        ///
+        /// @return Does the draw function collect statistics?
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isRenderStatisticsEnabled() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the statistics that were collected during the last call to the draw function
+        ///
+        /// @return Statistics of the last frame, which are all 0 when collecting statistics is disabled
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const RenderStatistics& getRenderStatistics() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Loads the child widgets from a text file
         ///
@@ -408,6 +531,21 @@ namespace tgui
         void updateTime(const sf::Time& elapsedTime);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+      protected:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Converts the mouse position in the event and passes the event to the widgets
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool processEvent(sf::Event event);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Passes the events that were queued by handleEvent to the widgets
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void processQueuedEvents();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
       protected:
 
@@ -432,6 +570,18 @@ namespace tgui
 
         sf::View m_view;
 
+        bool m_drawBatching = false;
+
+        // Clipping areas of the widgets that are being drawn
+        ClippingStack m_clippingStack;
+
+        bool m_renderStatisticsEnabled = false;
+        RenderStatistics m_renderStatistics;
+
+        // Events that were passed to handleEvent while queueing is enabled, with consecutive move events merged
+        bool m_eventQueueing = false;
+        std::vector<sf::Event> m_queuedEvents;
+
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     };
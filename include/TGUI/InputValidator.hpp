@@ -0,0 +1,175 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef TGUI_INPUT_VALIDATOR_HPP
+#define TGUI_INPUT_VALIDATOR_HPP
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <TGUI/Global.hpp>
+#include <SFML/System/String.hpp>
+#include <regex>
+#include <string>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Checks whether a text completely matches a regular expression
+    ///
+    /// The pattern is compiled once into a deterministic automaton that works on unicode code points. Because the automaton
+    /// reads the text one character at a time, the state after a part of the text can be stored and matching can later be
+    /// continued from there when characters are added behind it.
+    ///
+    /// The patterns used by EditBox::Validator::Int, UInt and Float are recognized and handled without building an automaton.
+    /// Patterns that use features that an automaton can't represent (e.g. backreferences or lookahead) are matched with
+    /// std::regex instead, in which case the text is converted to an ansi string and nothing can be matched incrementally.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API InputValidator
+    {
+    public:
+
+        typedef std::size_t State; ///< State of the automaton after reading part of a text
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Constructor
+        ///
+        /// @param pattern  Regular expression in ECMAScript syntax that the whole text has to match
+        ///
+        /// @throw std::regex_error when the pattern isn't a valid regular expression
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        InputValidator(const std::string& pattern = ".*");
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the pattern that was passed to the constructor
+        ///
+        /// @return Regular expression
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const std::string& getPattern() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the pattern was compiled into an automaton or handled by a fast path
+        ///
+        /// @return True when the state functions can be used, false when matching falls back to std::regex
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isIncremental() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Checks whether a text completely matches the pattern
+        ///
+        /// @param text  Text to check
+        ///
+        /// @return Does the text match?
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool match(const sf::String& text) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the state in which matching starts, before any character has been read
+        ///
+        /// @return Start state
+        ///
+        /// This function may only be called when isIncremental returns true.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        State getStartState() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Reads the next character of the text
+        ///
+        /// @param state      State after reading the characters in front of the new one
+        /// @param codePoint  Character that follows them
+        ///
+        /// @return State after reading the character. Once no text starting with the characters can match anymore, the
+        ///         returned state will never become accepting again.
+        ///
+        /// This function may only be called when isIncremental returns true.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        State advance(State state, sf::Uint32 codePoint) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the characters that were read so far match the pattern
+        ///
+        /// @param state  State after reading the text
+        ///
+        /// @return Does the text that lead to this state match?
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isAccepting(State state) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Builds the automaton for the pattern. Returns false when the pattern contains something that isn't supported.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool compileAutomaton();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        enum class Type
+        {
+            All,        ///< Every text is accepted
+            Int,        ///< Hand-written matcher for EditBox::Validator::Int
+            UInt,       ///< Hand-written matcher for EditBox::Validator::UInt
+            Float,      ///< Hand-written matcher for EditBox::Validator::Float
+            Automaton,  ///< The pattern was compiled into an automaton
+            Regex       ///< The pattern is matched with std::regex
+        };
+
+        std::string m_pattern;
+        Type m_type = Type::All;
+
+        // The automaton divides all code points into ranges that are treated the same way. The first code point of each range
+        // is stored here. The transitions are stored per state, with one entry for each range.
+        std::vector<sf::Uint32> m_rangeStarts;
+        std::vector<State> m_transitions;
+        std::vector<bool> m_acceptingStates;
+
+        std::regex m_regex;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_INPUT_VALIDATOR_HPP
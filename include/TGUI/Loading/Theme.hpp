@@ -97,6 +97,21 @@ namespace tgui
         bool removeRenderer(const std::string& id);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Renders the glyphs of the fonts used by the theme in advance
+        ///
+        /// @param textSizes   Text sizes for which the glyphs should be rendered (e.g. the result of WidgetLoader::findTextSizes)
+        /// @param characters  Characters to render, the printable ascii characters are used when the string is empty
+        ///
+        /// The fonts of all sections in the theme and the built-in default font are preloaded. The theme keeps these fonts
+        /// alive, so that widgets which get the same font afterwards don't have to render the glyphs again.
+        ///
+        /// @see Font::preloadGlyphs
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void preloadGlyphs(const std::vector<unsigned int>& textSizes, const sf::String& characters = "");
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Changes the function that will load the widget theme data
         ///
@@ -121,6 +136,7 @@ namespace tgui
         static std::shared_ptr<BaseThemeLoader> m_themeLoader;  ///< Theme loader which will do the actual loading
         std::map<std::string, std::shared_ptr<RendererData>> m_renderers; ///< Maps ids to renderer datas
         std::string m_primary;
+        std::vector<Font> m_preloadedFonts;
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
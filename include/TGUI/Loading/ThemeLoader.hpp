@@ -75,6 +75,19 @@ namespace tgui
         virtual const std::map<sf::String, sf::String>& load(const std::string& primary, const std::string& secondary) = 0;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the secondary parameters that can be loaded with a primary parameter
+        ///
+        /// @param primary  Primary parameter of the loader
+        ///
+        /// The default implementation returns an empty list, a loader doesn't have to know in advance what can be loaded.
+        ///
+        /// @return Secondary parameters (section names in DefaultThemeLoader)
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual std::vector<std::string> getSecondaryParameters(const std::string& primary);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     };
 
@@ -118,6 +131,19 @@ namespace tgui
         virtual const std::map<sf::String, sf::String>& load(const std::string& filename, const std::string& section) override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the names of the sections in a theme file
+        ///
+        /// @param filename  Filename of the theme file
+        ///
+        /// @return Lowercase names of all sections in the file
+        ///
+        /// @exception Exception when finding syntax errors in the file
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual std::vector<std::string> getSecondaryParameters(const std::string& filename) override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Empties the caches and force files to be reloaded.
         ///
@@ -128,6 +154,30 @@ namespace tgui
         static void flushCache(const std::string& filename = "");
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether the images used by a theme file are packed together in a single texture
+        ///
+        /// @param enabled  Should an atlas be created when preloading a theme file?
+        ///
+        /// When enabled, all images referenced by the textures in the theme file are loaded when the file is preloaded and
+        /// they are placed in one texture atlas. Widgets using the theme can then be drawn without switching textures.
+        /// The atlas is disabled by default.
+        ///
+        /// @see TextureManager::createAtlas
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void setTextureAtlasEnabled(bool enabled);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the images used by a theme file are packed together in a single texture
+        ///
+        /// @return Is an atlas created when preloading a theme file?
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static bool isTextureAtlasEnabled();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
@@ -144,6 +194,7 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
         static std::map<std::string, std::map<std::string, std::map<sf::String, sf::String>>> m_propertiesCache;
+        static bool m_textureAtlasEnabled;
 
         friend struct DefaultThemeLoaderTest; // Used for testing m_propertiesCache
     };
@@ -57,6 +57,20 @@ namespace tgui
         static void load(Container::Ptr parent, std::stringstream& stream);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Finds all text sizes that are set in a widget file
+        ///
+        /// @param stream  Stream containing the widget file
+        ///
+        /// The result can be passed to Theme::preloadGlyphs. Widgets that calculate their text size from their height
+        /// don't store a text size in the file, so these sizes are not part of the result.
+        ///
+        /// @return Text sizes used in the file, sorted from small to large
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::vector<unsigned int> findTextSizes(std::stringstream& stream);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Changes the load function for a certain widget type
         ///
@@ -0,0 +1,142 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef TGUI_MAPPED_FILE_HPP
+#define TGUI_MAPPED_FILE_HPP
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <TGUI/Config.hpp>
+#include <cstddef>
+#include <memory>
+#include <string>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Read-only view on the contents of a file that is mapped into memory
+    ///
+    /// Only the parts of the file that are accessed are read from disk, and the memory can be shared with other processes
+    /// that map the same file. Memory mapping is supported on Windows, Linux, macOS and FreeBSD. On other platforms, or when
+    /// the file can't be mapped, the whole file is read into memory that is owned by this object instead.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API MappedFile
+    {
+    public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Default constructor
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        MappedFile() = default;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // The mapping cannot be copied
+        MappedFile(const MappedFile& copy) = delete;
+        MappedFile& operator=(const MappedFile& right) = delete;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Unmaps the file
+        ~MappedFile();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Maps a file into memory
+        ///
+        /// @param filename       Filename of the file to open
+        /// @param mapIntoMemory  Should the file be mapped? When false or when mapping fails, the file is read instead.
+        ///
+        /// @return False when the file couldn't be opened or read. Opening an empty file succeeds, but getData will return
+        ///         a nullptr for it.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool open(const std::string& filename, bool mapIntoMemory = true);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Unmaps the file that was opened
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void close();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the contents of the file are mapped into memory
+        ///
+        /// @return True when the file is mapped, false when it was read into memory or when no file is opened
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isMapped() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the contents of the file
+        ///
+        /// @return Pointer to the first byte of the file, or nullptr when no file is mapped
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const char* getData() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the size of the file
+        ///
+        /// @return Amount of bytes in the file
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t getSize() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        // Maps the file into memory, returns false when the platform doesn't support it or when it fails
+        bool map(const std::string& filename);
+
+        // Reads the whole file into m_buffer
+        bool read(const std::string& filename);
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        // Handles of the file and the mapping object on Windows
+        void* m_fileHandle = nullptr;
+        void* m_mappingHandle = nullptr;
+
+        // Contents of the file when it wasn't mapped
+        std::unique_ptr<char[]> m_buffer;
+
+        const char* m_data = nullptr;
+        std::size_t m_size = 0;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_MAPPED_FILE_HPP
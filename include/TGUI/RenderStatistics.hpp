@@ -0,0 +1,123 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef TGUI_RENDER_STATISTICS_HPP
+#define TGUI_RENDER_STATISTICS_HPP
+
+#include <TGUI/Global.hpp>
+#include <SFML/System/String.hpp>
+#include <SFML/System/Time.hpp>
+#include <memory>
+#include <string>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace sf
+{
+    class Texture;
+}
+
+namespace tgui
+{
+    class Widget;
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Statistics about the work that was done while drawing a single frame of the gui
+    ///
+    /// @see Gui::setRenderStatisticsEnabled
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API RenderStatistics
+    {
+    public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Time that was spent drawing a widget that was added directly to the gui, including all its children
+        ///
+        /// The statistics don't keep the widget alive, the name and type still identify it after it has been removed.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        struct WidgetTime
+        {
+            std::weak_ptr<Widget> widget; ///< The widget that was drawn, expired when it no longer exists
+            sf::String widgetName;        ///< Name of the widget in the gui
+            std::string widgetType;       ///< Type of the widget
+            sf::Time time;                ///< Time spent drawing the widget
+        };
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Resets all counters to 0
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void reset();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        // Returns the statistics that are being collected for the frame that is currently being drawn, or nullptr
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static RenderStatistics* getActive();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        // Changes the statistics to which the draw calls, scissor changes and widgets are counted
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void setActive(RenderStatistics* statistics);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        // Counts a draw call on a render target
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addDrawCall(std::size_t vertexCount, const sf::Texture* texture);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    public:
+
+        std::size_t drawCalls = 0;            ///< Amount of times that something was drawn to a render target
+        std::size_t vertices = 0;             ///< Amount of vertices that were passed to the draw calls
+        std::size_t textureSwitches = 0;      ///< Amount of draw calls that used a different texture than the previous draw call
+        std::size_t scissorChanges = 0;       ///< Amount of times that the clipping area was changed with glScissor
+        std::size_t widgetsVisited = 0;       ///< Amount of widgets that were drawn
+        std::size_t widgetsCulled = 0;        ///< Amount of widgets that were skipped because they were outside the clipping area
+        std::vector<WidgetTime> widgetTimes;  ///< Time spent on each visible widget that was added directly to the gui
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        const sf::Texture* m_lastTexture = nullptr;
+
+        static RenderStatistics* m_activeStatistics;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_RENDER_STATISTICS_HPP
@@ -162,6 +162,19 @@ namespace tgui
         }
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether no signal handlers are connected to the signal
+        ///
+        /// This can be used to avoid creating the parameters of the signal when nobody would receive them.
+        ///
+        /// @return True when emitting the signal would not call any function
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isEmpty() const
+        {
+            return m_handlers.empty();
+        }
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
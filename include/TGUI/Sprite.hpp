@@ -219,7 +219,8 @@ namespace tgui
 
         sf::Vector2f m_size;
         Texture      m_texture;
-        std::vector<sf::Vertex> m_vertices;
+        mutable std::vector<sf::Vertex> m_vertices;
+        mutable sf::Vector2i m_textureOffset; // Location of the image inside the texture when the vertices were last updated
 
         sf::FloatRect m_visibleRect;
 
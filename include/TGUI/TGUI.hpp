@@ -28,6 +28,13 @@
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 #include <TGUI/Clipboard.hpp>
+#include <TGUI/DrawBatch.hpp>
+#include <TGUI/RenderStatistics.hpp>
+#include <TGUI/FontManager.hpp>
+#include <TGUI/FontMetrics.hpp>
+#include <TGUI/MappedFile.hpp>
+#include <TGUI/TextDocument.hpp>
+#include <TGUI/InputValidator.hpp>
 #include <TGUI/Animation.hpp>
 #include <TGUI/Widget.hpp>
 #include <TGUI/ToolTip.hpp>
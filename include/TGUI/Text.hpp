@@ -31,6 +31,12 @@
 #include <TGUI/TextStyle.hpp>
 #include <SFML/Graphics/Text.hpp>
 #include <SFML/Graphics/Transformable.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+#if SFML_VERSION_MAJOR > 2 || (SFML_VERSION_MAJOR == 2 && SFML_VERSION_MINOR >= 5)
+    #include <SFML/Graphics/VertexBuffer.hpp>
+#endif
+#include <memory>
+#include <vector>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -61,6 +67,23 @@ namespace tgui
         static float calculateExtraVerticalSpace(Font font, unsigned int characterSize, TextStyle style = sf::Text::Regular);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// Finds where a string has to be split in lines so that the width does not exceed maxWidth.
+        ///
+        /// @param maxWidth         Maximum width of the text, or 0 to only split the text on its newlines
+        /// @param text             The text to wrap
+        /// @param font             Font of the text, when it is a nullptr the text is only split on its newlines
+        /// @param textSize         The text size
+        /// @param bold             Is the text bold?
+        /// @param dropLeadingSpace Should a single space at the beginning of a line be moved to the end of the previous line?
+        ///
+        /// @return Indices in the text at which a new line starts. Line i runs from the previous break (or the start of the
+        ///         text) up to break i (or the end of the text), the newline character before a break isn't part of the line.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::vector<std::size_t> findLineBreaks(float maxWidth, const sf::String& text, Font font, unsigned int textSize, bool bold, bool dropLeadingSpace = true);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// Takes a string and inserts newlines into it so that the width does not exceed maxWidth.
         ///
@@ -218,6 +241,9 @@ namespace tgui
         /// \param target Render target to draw to
         /// \param states Current render states
         ///
+        /// The glyph quads are only created again when the string, font, character size or style changed since the last draw.
+        /// Moving the text or changing its color or opacity reuses the existing geometry.
+        ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void draw(sf::RenderTarget& target, sf::RenderStates states) const;
 
@@ -231,6 +257,18 @@ namespace tgui
         void recalculateSize();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Creates the glyph quads for the current string, font, character size and style
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateGeometry() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Changes the color of the existing glyph quads without recreating them
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateVertexColors() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
 
@@ -239,6 +277,27 @@ namespace tgui
         Font         m_font;
         Color        m_color;
         float        m_opacity = 1;
+
+        // Glyph quads relative to the position of the text, created when the text is drawn
+        mutable std::vector<sf::Vertex> m_vertices;
+        mutable bool m_geometryNeedUpdate = true;
+        mutable bool m_colorNeedUpdate = false;
+
+    #if SFML_VERSION_MAJOR > 2 || (SFML_VERSION_MAJOR == 2 && SFML_VERSION_MINOR >= 5)
+        // Copy of the glyph quads in video memory, used when the text isn't drawn in a batch.
+        // Copies of the text don't share the buffer, they upload their own vertices the first time they are drawn.
+        struct VertexBufferCache
+        {
+            VertexBufferCache() = default;
+            VertexBufferCache(const VertexBufferCache&) {}
+            VertexBufferCache& operator=(const VertexBufferCache&) { buffer = nullptr; needsUpdate = true; return *this; }
+
+            std::unique_ptr<sf::VertexBuffer> buffer;
+            bool needsUpdate = true;
+        };
+
+        mutable VertexBufferCache m_vertexBuffer;
+    #endif
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
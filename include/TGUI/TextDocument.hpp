@@ -0,0 +1,135 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef TGUI_TEXT_DOCUMENT_HPP
+#define TGUI_TEXT_DOCUMENT_HPP
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <TGUI/MappedFile.hpp>
+#include <SFML/System/String.hpp>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Read-only UTF-8 text file that is accessed line by line
+    ///
+    /// The file is mapped into memory (or read into memory where mapping isn't possible) and is never decoded as a whole.
+    /// The positions of the lines are found while the file is being read. Only the position of every 64th line is stored.
+    /// Lines in between are found by scanning forward from the nearest stored position, so the index stays small even for
+    /// huge files.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API TextDocument
+    {
+    public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Opens a file
+        ///
+        /// @param filename  Filename of the UTF-8 encoded file to open
+        ///
+        /// @return False when the file couldn't be opened
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool open(const std::string& filename);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Continues searching the positions of the lines in the file
+        ///
+        /// @param maxBytes  Maximum amount of bytes to scan during this call
+        ///
+        /// @return True when the whole file has been scanned
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool buildIndex(std::size_t maxBytes);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the positions of all lines in the file are known
+        ///
+        /// @return Has the whole file been scanned?
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isIndexComplete() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of lines in the file
+        ///
+        /// @return Number of lines when the index is complete. Otherwise the number is estimated from the average length of the
+        ///         lines that were already found.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t getLineCount() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Decodes a line from the file
+        ///
+        /// @param lineIndex  Index of the line, starting from 0
+        /// @param line       String in which the line is returned, without its newline character
+        ///
+        /// @return False when the file contains less lines
+        ///
+        /// The index is extended when the requested line lies behind the part of the file that was already scanned.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool readLine(std::size_t lineIndex, sf::String& line);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the size of the file
+        ///
+        /// @return Amount of bytes in the file
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t getSize() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        MappedFile m_file;
+
+        // Position of line i * LinesPerCheckpoint
+        std::vector<std::size_t> m_checkpoints;
+
+        // Number of lines that start in the part of the file that was already scanned
+        std::size_t m_indexedLines = 0;
+        std::size_t m_indexedBytes = 0;
+
+        static const std::size_t LinesPerCheckpoint = 64;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_TEXT_DOCUMENT_HPP
@@ -214,6 +214,10 @@ namespace tgui
         /// However if you want the texture to look exactly the same as its source file, you should leave it disabled.
         /// The smooth filter is disabled by default.
         ///
+        /// Textures loaded from different parts of the same image (or from images in an atlas) normally share the same texture
+        /// on the gpu. Enabling the filter copies the part to a texture of its own, so that the surrounding pixels don't bleed
+        /// into its edges and the other textures aren't affected. Such a texture can no longer be batched with the others.
+        ///
         /// @param smooth True to enable smoothing, false to disable it
         ///
         /// @see isSmooth
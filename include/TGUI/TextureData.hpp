@@ -46,9 +46,12 @@ namespace tgui
     // Used by the Texture class
     struct TGUI_API TextureData
     {
-        std::unique_ptr<sf::Image> image;
-        sf::Texture texture;
-        sf::IntRect rect;
+        std::shared_ptr<sf::Image> image;     // Entire image from which the texture was loaded, shared between all parts of the image
+        std::shared_ptr<sf::Texture> texture; // Texture on the gpu, which may be shared with other parts of the image or with other images
+        sf::IntRect rect;                     // Part of the image that was loaded (empty when the entire image is used)
+        sf::IntRect textureRect;              // Location of the loaded part inside the texture
+        bool inAtlas = false;                 // Is the texture an atlas created by TextureManager::createAtlas?
+        bool separateTexture = false;         // Does the part have a texture of its own, because smoothing was enabled on it?
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -30,6 +30,7 @@
 
 #include <TGUI/TextureData.hpp>
 #include <memory>
+#include <vector>
 #include <list>
 #include <map>
 
@@ -52,6 +53,8 @@ namespace tgui
         /// @param partRect   Load only part of the image. Don't pass this parameter if you want to load the full image
         ///
         /// The second time you call this function with the same filename, the previously loaded image will be reused.
+        /// All parts of the same image share a single texture on the gpu, the part is selected with the texture coordinates.
+        /// Parts on which smoothing is enabled get a texture of their own, see Texture::setSmooth.
         ///
         /// @return Texture data when loaded successfully, nullptr otherwise
         ///
@@ -79,10 +82,44 @@ namespace tgui
         static void removeTexture(std::shared_ptr<TextureData> textureDataToRemove);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Packs multiple images together in a single texture
+        ///
+        /// @param filenames  Filenames of the images to put in the atlas
+        ///
+        /// Textures that are loaded afterwards from one of these images will be located in the atlas, which allows drawing
+        /// them without switching textures in between. Textures that were already loaded before are not affected.
+        /// Images that are already part of another atlas or that fail to load are skipped.
+        /// Textures on which smoothing is enabled are copied out of the atlas, see Texture::setSmooth.
+        ///
+        /// @return True when the atlas was created, false when no images were loaded or they didn't fit in a single texture
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static bool createAtlas(const std::vector<std::string>& filenames);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Stops using the atlases created with createAtlas for new textures
+        ///
+        /// The memory of an atlas is released once all textures that are located in it are destroyed.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void removeAtlases();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
+        // Location of an image inside an atlas
+        struct AtlasImage
+        {
+            std::shared_ptr<sf::Image> image;
+            std::shared_ptr<sf::Texture> texture;
+            sf::Vector2i offset;
+        };
+
         static std::map<std::string, std::list<TextureDataHolder>> m_imageMap;
+        static std::map<std::string, AtlasImage> m_atlasImages;
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -373,6 +373,17 @@ namespace tgui
         Widget::Ptr getToolTip();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Informs the parents of the widget that the widget looks different than the last time it was drawn
+        ///
+        /// Containers that cache their contents (see Container::setLayerCached) only draw their child widgets again after
+        /// one of them was invalidated, and Gui::needsRedraw is based on it. Widgets call this function themselves when their
+        /// appearance changes, so you only need to call it after changing something that the widget can't detect by itself.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void invalidate();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
         /// This function is called when the widget is added to a container.
@@ -388,6 +399,14 @@ namespace tgui
         virtual void update(sf::Time elapsedTime);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        // Returns how long it takes before the widget changes by itself, e.g. because of an animation or a blinking caret.
+        // The time is 0 while the widget is being animated and infinite when nothing is going to change.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual sf::Time timeUntilNextUpdate() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns whether the mouse position (which is relative to the parent widget) lies on top of the widget
         ///
@@ -463,6 +482,14 @@ namespace tgui
         void updateParentSize(sf::Vector2f size);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        // Returns the area in which the widget draws, relative to the parent.
+        // The parent won't draw the widget when this area lies completely outside the clipping area.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual sf::FloatRect getDrawBounds() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Draw the widget to a render target
         ///
@@ -525,6 +552,13 @@ namespace tgui
         virtual void mouseLeftWidget();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Tells the parent that the area in which the mouse can be on top of the widget may have changed.
+        // Widgets should call this when their full size or widget offset changes without their size being changed.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void hitAreaChanged();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Draw a rectangle shape with the right opacity
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -578,6 +612,9 @@ namespace tgui
         // This will point to our parent widget. If there is no parent then this will be nullptr.
         Container* m_parent = nullptr;
 
+        // Position of the widget between the other widgets of its parent, widgets that are drawn later have a higher value
+        std::size_t m_orderInParent = 0;
+
         // Is the mouse on top of the widget? Did the mouse go down on the widget?
         bool m_mouseHover = false;
         bool m_mouseDown = false;
@@ -597,6 +634,10 @@ namespace tgui
         // This is set to true for widgets that store other widgets inside them
         bool m_containerWidget = false;
 
+        // This is set to false for widgets where the mouse can be on top of them outside the area given by
+        // getWidgetOffset and getFullSize (e.g. a menu bar with an open menu)
+        bool m_hitAreaInFullSize = true;
+
         // The tool tip connected to the widget
         Widget::Ptr m_toolTip = nullptr;
 
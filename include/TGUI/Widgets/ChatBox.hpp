@@ -30,7 +30,10 @@
 #include <TGUI/Widgets/Scrollbar.hpp>
 #include <TGUI/Renderers/ChatBoxRenderer.hpp>
 #include <TGUI/Text.hpp>
-#include <deque>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -48,10 +51,72 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
+        // Only the raw line is stored, it is only wrapped when it gets near the visible area
         struct Line
         {
-            Text text;
             sf::String string;
+            sf::Color color;
+            unsigned int textSize = 0;
+            Font font;
+            std::uint64_t id = 0;
+            float height = 0; // Height that is stored in the height tree, which is only an estimate until the line is wrapped
+            unsigned int wrapGeneration = 0; // The line is wrapped when this equals m_wrapGeneration
+        };
+
+        // The lines that are inside the visible area, with their text wrapped and ready to be drawn
+        struct VisibleLine
+        {
+            std::uint64_t id;
+            unsigned int wrapGeneration;
+            float height;
+            Text text;
+        };
+
+        // Line that was queued from another thread and that still has to be added to the chat box
+        struct QueuedLine
+        {
+            sf::String text;
+            sf::Color color;
+            unsigned int textSize = 0;
+            Font font;
+            bool useDefaultColor = true;
+            bool useDefaultTextSize = true;
+            QueuedLine* next = nullptr;
+        };
+
+        // Lock-free queue to which multiple threads can add lines while only the gui thread takes them out
+        class LineQueue
+        {
+        public:
+            LineQueue() = default;
+            ~LineQueue();
+
+            // The lines that are waiting in the queue belong to the chat box that queued them and are not copied
+            LineQueue(const LineQueue&);
+            LineQueue& operator=(const LineQueue&);
+
+            // Adds a line to the queue, this can be called from any thread
+            void push(std::unique_ptr<QueuedLine> line);
+
+            // Empties the queue and returns the lines that were in it, in the order in which they were pushed.
+            // Returns nothing when another thread is trimming the queue at that moment, the lines are taken the next time.
+            std::vector<std::unique_ptr<QueuedLine>> takeAll();
+
+            // Returns whether there are lines waiting in the queue
+            bool isEmpty() const;
+
+            // Sets the amount of lines that have to be kept when the queue grows too large, 0 means unlimited
+            void setCapacity(std::size_t capacity);
+
+        private:
+            // Removes the oldest lines until only the given amount of lines is left, when no other thread is taking lines
+            void trim(std::size_t capacity);
+
+        private:
+            std::atomic<QueuedLine*> m_head{nullptr};
+            std::atomic<std::size_t> m_size{0};
+            std::atomic<std::size_t> m_capacity{0};
+            std::atomic<bool> m_busy{false};
         };
 
 
@@ -177,6 +242,60 @@ namespace tgui
         void addLine(const sf::String& text, const sf::Color& color, unsigned int textSize, const Font& font = nullptr);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Queues a new line of text that will be added to the chat box the next time the widget is updated
+        ///
+        /// Unlike addLine, this function may be called from any thread. The queued lines are added in one batch when the gui
+        /// updates the widget (once per Gui::updateTime call, while the chat box is visible), in the order they were queued.
+        /// Lines queued while the chat box is hidden are added when it is shown again. When there is a line limit, only the
+        /// newest lines are kept in the queue in the meantime.
+        ///
+        /// The default text color and character size that are set at that moment will be used.
+        ///
+        /// @param text  Text that will be added to the chat box
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void queueLine(const sf::String& text);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Queues a new line of text that will be added to the chat box the next time the widget is updated
+        ///
+        /// Unlike addLine, this function may be called from any thread.
+        ///
+        /// @param text      Text that will be added to the chat box
+        /// @param textSize  Size of the text
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void queueLine(const sf::String& text, unsigned int textSize);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Queues a new line of text that will be added to the chat box the next time the widget is updated
+        ///
+        /// Unlike addLine, this function may be called from any thread.
+        ///
+        /// @param text   Text that will be added to the chat box
+        /// @param color  Color of the text
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void queueLine(const sf::String& text, const sf::Color& color);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Queues a new line of text that will be added to the chat box the next time the widget is updated
+        ///
+        /// Unlike addLine, this function may be called from any thread.
+        ///
+        /// @param text      Text that will be added to the chat box
+        /// @param color     Color of the text
+        /// @param textSize  Size of the text
+        /// @param font      Font of the text (nullptr to use default font)
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void queueLine(const sf::String& text, const sf::Color& color, unsigned int textSize, const Font& font = nullptr);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns the contents of the requested line
         ///
@@ -276,6 +395,17 @@ namespace tgui
         std::size_t getLineLimit();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Shows the widget
+        ///
+        /// The lines that were queued while the chat box was hidden are added immediately.
+        ///
+        /// @see hide
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void show() override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Changes the default character size of the text
         ///
@@ -397,18 +527,121 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         virtual void mouseNoLongerDown() override;
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// Adds the lines that were queued since the last update.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void update(sf::Time elapsedTime) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns zero while there are queued lines that still have to be added.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual sf::Time timeUntilNextUpdate() const override;
+
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // Recalculates the text attribute of the line
+        // Adds a line without updating the scrollbar and the visible lines
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void insertLine(const sf::String& text, const sf::Color& color, unsigned int textSize, const Font& font);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Adds all lines that are waiting in the queue
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addQueuedLines();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the line at the given index, the index has to be smaller than m_lineCount
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Line& getLineAt(std::size_t lineIndex);
+        const Line& getLineAt(std::size_t lineIndex) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Adds a line to the front or back of the ring buffer, which grows when it is full
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void pushLine(Line&& line, bool back);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Removes the first or last line from the ring buffer
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void recalculateLineText(Line& line);
+        void popLine(bool back);
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // Recalculates all text attributes, recalculate the full text height and update the displayed text
+        // Moves the lines to a ring buffer with a different capacity, the first line is placed at the start of the buffer
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void reserveLines(std::size_t capacity);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Fills the height tree again with the heights of all lines
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void rebuildHeightTree();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Adds a value to the height of a slot in the ring buffer
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addToHeightTree(std::size_t slot, double height);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the sum of the heights in the first slots of the ring buffer
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        double getHeightOfSlots(std::size_t slotCount) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the amount of slots at the start of the ring buffer of which the summed height doesn't exceed the given height
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t findSlotsWithinHeight(double height) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the summed height of all lines in front of the line with the given index
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        float getHeightAboveLine(std::size_t lineIndex) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the index of the line that is displayed at a certain height, in O(log n)
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t findLineAtHeight(float height) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Changes the height of a line and updates the height tree
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setLineHeight(std::size_t lineIndex, float height);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the height that the line would have without wrapping it
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        float estimateLineHeight(const Line& line) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the height of the line after wrapping it
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        float calculateLineHeight(const Line& line) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the width available for the text
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        float getMaximumLineWidth() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Marks all lines as needing to be wrapped again and updates the displayed lines
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void recalculateAllLines();
 
@@ -420,9 +653,9 @@ namespace tgui
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // Updates the position of the lines
+        // Wraps the lines near the visible area and creates the texts for the lines that are visible
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void updateDisplayedText();
+        void updateVisibleLines();
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -483,7 +716,22 @@ namespace tgui
 
         ScrollbarChildWidget m_scroll;
 
-        std::deque<Line> m_lines;
+        // Ring buffer with the lines, line i is stored at slot (m_firstLine + i) % m_lines.size()
+        std::vector<Line> m_lines;
+        std::size_t m_firstLine = 0;
+        std::size_t m_lineCount = 0;
+
+        // Fenwick tree with the heights of the slots in the ring buffer
+        std::vector<double> m_heightTree;
+
+        std::vector<VisibleLine> m_visibleLines;
+        float m_visibleLinesTop = 0;
+
+        LineQueue m_queuedLines;
+
+        std::uint64_t m_nextLineId = 1;
+        unsigned int m_wrapGeneration = 1;
+        float m_wrapWidth = 0;
 
         Sprite m_spriteBackground;
 
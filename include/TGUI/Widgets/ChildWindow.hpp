@@ -432,6 +432,7 @@ namespace tgui
         Button::Ptr m_maximizeButton;
 
         bool m_mouseDownOnTitleBar = false;
+        bool m_mouseOnTitleButton = false;
         bool m_keepInParent = false;
 
         bool m_resizable = false;
@@ -30,7 +30,8 @@
 #include <TGUI/Renderers/EditBoxRenderer.hpp>
 #include <TGUI/FloatRect.hpp>
 #include <TGUI/Text.hpp>
-#include <regex>
+#include <TGUI/InputValidator.hpp>
+#include <vector>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -370,6 +371,9 @@ namespace tgui
         /// When the regex does not match when calling the setText function then the edit box contents will be cleared.
         /// When it does not match when the user types a character in the edit box, then the input character is rejected.
         ///
+        /// The regex is compiled once into an automaton (see InputValidator), so that typing a character at the end of the
+        /// text doesn't require checking the whole text again.
+        ///
         /// Examples:
         /// @code
         /// edit1->setInputValidator(EditBox::Validator::Int);
@@ -471,6 +475,57 @@ namespace tgui
         std::size_t findCaretPosition(float posX);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the width of the displayed text.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        float getFullTextWidth() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Measures all characters of the displayed text again. Has to be called when the font, text size or text style changes.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void recalculateCharPositions();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Updates the character positions after the displayed text was changed at the given position. Only the inserted
+        // characters and the character behind them are measured, the positions behind them are shifted.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateCharPositions(std::size_t pos, std::size_t erasedChars, std::size_t insertedChars);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Inserts and erases characters in both the text and the displayed text.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void insertCharacters(std::size_t pos, const sf::String& text);
+        void eraseCharacters(std::size_t pos, std::size_t count);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns whether the text would still match the validator when inserting the given characters at the given position.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isValidInsertion(std::size_t pos, const sf::String& text) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Inserts the pasted characters at the caret while respecting the validator, the character limit and the text width
+        // limit. Returns false when nothing was inserted.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool pasteCharacters(sf::String text);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Moves the text to the right when there is empty space behind it while part of the text is hidden on the left side.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateTextCropPosition();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Updates the validator states after the text was changed at the given position.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateValidatorStates(std::size_t pos);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Removes the selected characters. This function is called when pressing backspace, delete or a letter while there were
         // some characters selected.
@@ -490,6 +545,12 @@ namespace tgui
         virtual void update(sf::Time elapsedTime) override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the time until the caret blinks when the widget is focused.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual sf::Time timeUntilNextUpdate() const override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Makes a copy of the widget
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -522,8 +583,9 @@ namespace tgui
         // The text inside the edit box
         sf::String    m_text;
 
-        std::string   m_regexString = ".*";
-        std::regex    m_regex = std::regex{m_regexString};
+        // The validator and its state after every part of the text (only used when the validator is incremental)
+        InputValidator m_validator;
+        std::vector<InputValidator::State> m_validatorStates;
 
         // This will store the size of the text ( 0 to auto size )
         unsigned int  m_textSize = 0;
@@ -555,12 +617,19 @@ namespace tgui
         // Is there a possibility that the user is going to double click?
         bool m_possibleDoubleClick = false;
 
-        // We need three texts for drawing + one for the default text + one more for calculations.
+        // The text as it is displayed (filled with the password character when there is one)
+        sf::String m_displayedText;
+
+        // Caret position in front of every character of the displayed text, with the width of the whole text as last element.
+        // The positions are updated incrementally when characters are inserted or erased.
+        std::vector<float> m_charPositions = {0};
+
+        // We need three texts for drawing + one for the default text.
+        // Only the part of the displayed text that is visible inside the edit box is stored in the three texts.
         Text m_textBeforeSelection;
         Text m_textSelection;
         Text m_textAfterSelection;
         Text m_defaultText;
-        Text m_textFull;
 
         Sprite m_sprite;
         Sprite m_spriteHover;
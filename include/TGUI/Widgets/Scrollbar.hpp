@@ -395,6 +395,27 @@ namespace tgui
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Remembers that the scrollbar changed
+        ///
+        /// The scrollbar has no parent to pass this on to. The widget that owns it asks for it with wasInvalidated instead.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void invalidate() override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the scrollbar changed since the last time this function was called
+        ///
+        /// @return Should the widget that owns the scrollbar be invalidated?
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool wasInvalidated();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        bool m_invalidated = false;
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -30,6 +30,7 @@
 #include <TGUI/Widgets/Scrollbar.hpp>
 #include <TGUI/Renderers/TextBoxRenderer.hpp>
 #include <TGUI/Text.hpp>
+#include <TGUI/TextDocument.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -109,11 +110,43 @@ namespace tgui
         void setText(const sf::String& text);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Shows the contents of a UTF-8 file in the text box without loading the file into memory
+        ///
+        /// @param filename  Filename of the file to show
+        ///
+        /// @return False when the file couldn't be opened, in which case the text box isn't changed
+        ///
+        /// The file is mapped into memory and only the lines that are visible get decoded and word-wrapped, so memory usage
+        /// depends on the size of the text box instead of the size of the file. While a file is shown, the text box is
+        /// read-only and text can't be selected. getText returns an empty string and getLinesCount returns the amount of lines
+        /// in the file, which is estimated until the whole file has been scanned (this happens a few megabytes at a time each
+        /// time the widget is updated). The scrollbar scrolls per line of the file, lines that are longer than the width of
+        /// the text box take multiple rows on the screen. Once the whole file has been scanned, the range of the scrollbar
+        /// takes the rows of the last lines into account so that the end of the file can be scrolled into view.
+        ///
+        /// Calling setText closes the file again.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool openDocument(const std::string& filename);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the text box is showing a file that was opened with openDocument
+        ///
+        /// @return Is a file being shown?
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isDocumentOpen() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Appends some text to the text that was already in the text box
         ///
         /// @param text  Text that will be added to the text that is already in the text box
         ///
+        /// Only the last paragraph of the existing text has to be word-wrapped again, so appending to a large text is cheap.
+        ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void addText(const sf::String& text);
 
@@ -336,6 +369,19 @@ namespace tgui
         std::pair<std::size_t, std::size_t> findTextSelectionPositions() const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the amount of characters in the text in front of a position (given as character and line index)
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t findIndex(sf::Vector2<std::size_t> position) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Converts an index in the text into a position (given as character and line index).
+        // The index is counted from the beginning of the given line, which has to be the first line of a paragraph.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        sf::Vector2<std::size_t> findPosition(std::size_t index, std::size_t firstLine = 0) const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // This function is called when you are selecting text.
         // It will find out which part of the text is selected.
@@ -350,6 +396,25 @@ namespace tgui
         void deleteSelectedCharacters();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Replaces the selected characters with another string and places the caret behind the inserted text.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void replaceSelectedCharacters(const sf::String& text);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Replaces the characters between two positions with another string and places the caret behind the inserted text.
+        // Only the paragraphs containing the positions are word-wrapped again, the other lines are left untouched.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void replaceText(sf::Vector2<std::size_t> start, sf::Vector2<std::size_t> end, const sf::String& text);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Splits the text in paragraphs and word-wraps each of them. The resulting lines are added to the given vectors.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void wrapText(const sf::String& text, std::vector<sf::String>& lines, std::vector<bool>& newlineAfterLine) const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Rearrange the text inside the text box (by using word wrap).
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -357,11 +422,44 @@ namespace tgui
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // This function will split the text into five pieces so that the text can be easily drawn.
+        // Updates the scrollbar and the displayed lines when a document is open
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void rearrangeDocument();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the scrollbar value at which the last line of the document is at the bottom of the text box.
+        // The last lines are word-wrapped to find out how many rows they take.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        double findDocumentScrollEnd();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Decodes and wraps the lines of the document that are visible
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateDocumentTexts();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // This function is called when the text or selection changed. It scrolls the caret into view and updates the texts.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void updateSelectionTexts();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // This function will split the lines near the visible area into five pieces so that the text can be easily drawn.
+        // The rest of the text is never put in the text objects, so drawing doesn't depend on the size of the document.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateVisibleTexts();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the part of the selection that lies on the lines that are stored in the text objects. Both positions are
+        // the same when nothing is selected on those lines.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::pair<sf::Vector2<std::size_t>, sf::Vector2<std::size_t>> findVisibleSelection() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Draw the widget to a render target
         ///
@@ -372,6 +470,12 @@ namespace tgui
         virtual void draw(sf::RenderTarget& target, sf::RenderStates states) const override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Draws the text, the selection and the caret when no document is open
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void drawText(sf::RenderTarget& target, sf::RenderStates states) const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
@@ -381,12 +485,24 @@ namespace tgui
         sf::Vector2f getInnerSize() const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the width that is available for a line of text
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        float getMaximumLineWidth() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // This function is called every frame with the time passed since the last frame.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         virtual void update(sf::Time elapsedTime) override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the time until the caret blinks when the widget is focused.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual sf::Time timeUntilNextUpdate() const override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Recalculates the positions of the contents of the text box.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -438,11 +554,18 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
-        sf::String   m_text;
         unsigned int m_textSize = 18;
         unsigned int m_lineHeight = 24;
 
-        std::vector<sf::String> m_lines;
+        // The text is stored as the lines that are displayed after word wrap. A paragraph (the text between two newline
+        // characters) can be spread over several lines, the flag of the last line of a paragraph indicates that a newline follows.
+        std::vector<sf::String> m_lines = std::vector<sf::String>(1);
+        std::vector<bool> m_newlineAfterLine = std::vector<bool>(1, false);
+        std::size_t m_textLength = 0;
+
+        // The whole text is only put in a single string when it is requested
+        mutable sf::String m_text;
+        mutable bool m_textCached = true;
 
         // The maximum characters (0 by default, which means no limit)
         std::size_t m_maxChars = 0;
@@ -465,8 +588,16 @@ namespace tgui
         Text m_textAfterSelection1;
         Text m_textAfterSelection2;
 
+        // Range of lines that are stored in the text objects
+        std::size_t m_textsFirstLine = 0;
+        std::size_t m_textsLastLine = 0;
+
         std::vector<sf::FloatRect> m_selectionRects;
 
+        // The file shown by openDocument and the texts of its visible lines
+        std::shared_ptr<TextDocument> m_document;
+        std::vector<Text> m_documentTexts;
+
         // The scrollbar
         ScrollbarChildWidget m_verticalScroll;
 
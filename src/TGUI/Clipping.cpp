@@ -0,0 +1,203 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include <TGUI/Clipping.hpp>
+#include <TGUI/RenderStatistics.hpp>
+
+#include <SFML/OpenGL.hpp>
+
+#include <algorithm>
+#include <cassert>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    ClippingStack* ClippingStack::m_activeStack = nullptr;
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ClippingStack::begin(const sf::RenderTarget& target)
+    {
+        m_target = &target;
+        m_previousStack = m_activeStack;
+        m_activeStack = this;
+
+        m_areas.clear();
+        m_areas.push_back({0, 0, static_cast<int>(target.getSize().x), static_cast<int>(target.getSize().y)});
+
+        glEnable(GL_SCISSOR_TEST);
+        apply(true);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ClippingStack::end()
+    {
+        assert(m_activeStack == this);
+
+        glDisable(GL_SCISSOR_TEST);
+
+        m_activeStack = m_previousStack;
+        m_previousStack = nullptr;
+        m_target = nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ClippingStack::restore()
+    {
+        glEnable(GL_SCISSOR_TEST);
+        apply(true);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ClippingStack::push(sf::IntRect area)
+    {
+        assert(!m_areas.empty());
+        const sf::IntRect& oldArea = m_areas.back();
+
+        const int left = std::max(area.left, oldArea.left);
+        const int top = std::max(area.top, oldArea.top);
+        int right = std::min(area.left + area.width, oldArea.left + oldArea.width);
+        int bottom = std::min(area.top + area.height, oldArea.top + oldArea.height);
+
+        // If the area lies outside the current clipping area then don't draw anything
+        if (right < left)
+            right = left;
+        if (bottom < top)
+            bottom = top;
+
+        m_areas.push_back({left, top, right - left, bottom - top});
+        apply(false);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ClippingStack::pop()
+    {
+        // The area covering the whole target is never removed
+        assert(m_areas.size() > 1);
+        m_areas.pop_back();
+        apply(false);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const sf::IntRect& ClippingStack::getArea() const
+    {
+        assert(!m_areas.empty());
+        return m_areas.back();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    ClippingStack* ClippingStack::getActive(const sf::RenderTarget& target)
+    {
+        if (m_activeStack && (m_activeStack->m_target == &target))
+            return m_activeStack;
+        else
+            return nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ClippingStack::apply(bool force)
+    {
+        const sf::IntRect& area = m_areas.back();
+        if (!force && (area == m_appliedArea))
+            return;
+
+        // Opengl has its origin in the bottom left corner of the target
+        glScissor(area.left, static_cast<GLint>(m_target->getSize().y) - area.top - area.height, area.width, area.height);
+        m_appliedArea = area;
+
+        if (RenderStatistics* statistics = RenderStatistics::getActive())
+            ++statistics->scissorChanges;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Clipping::Clipping(const sf::RenderTarget& target, const sf::RenderStates& states, sf::Vector2f topLeft, sf::Vector2f size) :
+        m_target{target},
+        m_stack {ClippingStack::getActive(target)}
+    {
+        // Geometry that was batched before this point should not be affected by the new clipping area
+        DrawBatch::flush(target);
+
+        // The widget is being drawn outside the gui, so nobody started clipping on this target yet
+        if (!m_stack)
+        {
+            m_ownStack = std::make_unique<ClippingStack>();
+            m_ownStack->begin(target);
+            m_stack = m_ownStack.get();
+        }
+
+        const sf::Vector2i topLeftPosition = target.mapCoordsToPixel(states.transform.transformPoint(topLeft));
+        const sf::Vector2i bottomRightPosition = target.mapCoordsToPixel(states.transform.transformPoint(topLeft + size));
+        m_stack->push({topLeftPosition.x, topLeftPosition.y, bottomRightPosition.x - topLeftPosition.x, bottomRightPosition.y - topLeftPosition.y});
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Clipping::~Clipping()
+    {
+        DrawBatch::flush(m_target);
+
+        m_stack->pop();
+        if (m_ownStack)
+            m_ownStack->end();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Clipping::isVisible(const sf::RenderTarget& target, const sf::RenderStates& states, const sf::FloatRect& area)
+    {
+        // When nothing is clipping this target, only the viewport limits what is visible
+        const ClippingStack* stack = ClippingStack::getActive(target);
+        const sf::IntRect clippingArea = stack ? stack->getArea() : target.getViewport(target.getView());
+        if ((clippingArea.width <= 0) || (clippingArea.height <= 0))
+            return false;
+
+        const sf::FloatRect transformedArea = states.transform.transformRect(area);
+        const sf::Vector2i corner1 = target.mapCoordsToPixel({transformedArea.left, transformedArea.top});
+        const sf::Vector2i corner2 = target.mapCoordsToPixel({transformedArea.left + transformedArea.width, transformedArea.top + transformedArea.height});
+
+        // The area is extended by one pixel on each side so that rounding can't hide anti-aliased edges
+        const int left = std::min(corner1.x, corner2.x) - 1;
+        const int top = std::min(corner1.y, corner2.y) - 1;
+        const int right = std::max(corner1.x, corner2.x) + 1;
+        const int bottom = std::max(corner1.y, corner2.y) + 1;
+
+        return (right > clippingArea.left) && (left < clippingArea.left + clippingArea.width)
+            && (bottom > clippingArea.top) && (top < clippingArea.top + clippingArea.height);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
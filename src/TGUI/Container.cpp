@@ -28,9 +28,17 @@
 #include <TGUI/Widgets/RadioButton.hpp>
 #include <TGUI/Loading/WidgetSaver.hpp>
 #include <TGUI/Loading/WidgetLoader.hpp>
+#include <TGUI/DrawBatch.hpp>
+#include <TGUI/Clipping.hpp>
+#include <TGUI/RenderStatistics.hpp>
 
+#include <SFML/Graphics/RenderWindow.hpp>
+
+#include <algorithm>
 #include <cassert>
+#include <cmath>
 #include <fstream>
+#include <limits>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -38,6 +46,47 @@ namespace tgui
 {
     extern TGUI_API bool TGUI_TabKeyUsageEnabled;
 
+    namespace
+    {
+        // Makes sure that gl calls affect the given target again after having drawn to a different render texture
+        void activateTarget(sf::RenderTarget& target)
+        {
+#if SFML_VERSION_MAJOR == 2 && SFML_VERSION_MINOR < 5
+            if (dynamic_cast<sf::RenderWindow*>(&target))
+                dynamic_cast<sf::RenderWindow*>(&target)->setActive(true);
+            else if (dynamic_cast<sf::RenderTexture*>(&target))
+                dynamic_cast<sf::RenderTexture*>(&target)->setActive(true);
+#else
+            target.setActive(true);
+#endif
+        }
+
+        // With fewer child widgets, checking every widget is faster than maintaining a hit test grid
+        const std::size_t MinWidgetsForHitTestGrid = 16;
+
+        // Maximum amount of rows and columns in the hit test grid
+        const std::size_t MaxHitTestGridCells = 64;
+
+        // Names are stored as UTF-8 in the name index of the containers
+        std::string toNameKey(const sf::String& name)
+        {
+            const auto utf8 = name.toUtf8();
+            return {utf8.begin(), utf8.end()};
+        }
+
+        // Returns the row or column of the hit test grid in which a coordinate lies, positions outside the grid belong to the border cells
+        std::size_t findHitTestCell(float pos, float origin, float cellSize, std::size_t cells)
+        {
+            const float cell = std::floor((pos - origin) / cellSize);
+            if (!(cell > 0))
+                return 0;
+            else if (cell >= static_cast<float>(cells - 1))
+                return cells - 1;
+            else
+                return static_cast<std::size_t>(cell);
+        }
+    }
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Container::Container()
@@ -49,7 +98,8 @@ namespace tgui
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Container::Container(const Container& other) :
-        Widget{other}
+        Widget       {other},
+        m_layerCached{other.m_layerCached}
     {
         // Copy all the widgets
         for (std::size_t i = 0; i < other.m_widgets.size(); ++i)
@@ -59,17 +109,28 @@ namespace tgui
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Container::Container(Container&& other) :
-        Widget                {std::move(other)},
-        m_widgets             {std::move(other.m_widgets)},
-        m_widgetNames         {std::move(other.m_widgetNames)},
-        m_widgetBelowMouse    {std::move(other.m_widgetBelowMouse)},
-        m_focusedWidget       {std::move(other.m_focusedWidget)},
-        m_handingMouseReleased{std::move(other.m_handingMouseReleased)}
+        Widget                   {std::move(other)},
+        m_widgets                {std::move(other.m_widgets)},
+        m_widgetNames            {std::move(other.m_widgetNames)},
+        m_widgetBelowMouse       {std::move(other.m_widgetBelowMouse)},
+        m_widgetWithLeftMouseDown{std::move(other.m_widgetWithLeftMouseDown)},
+        m_focusedWidget          {std::move(other.m_focusedWidget)},
+        m_handingMouseReleased   {std::move(other.m_handingMouseReleased)},
+        m_layerCached            {std::move(other.m_layerCached)},
+        m_layerInvalid           {true},
+        m_layerTexture           {std::move(other.m_layerTexture)},
+        m_layerSize              {std::move(other.m_layerSize)}
     {
+        // The named widgets no longer belong to the parents of the other container
+        other.updateNameIndexOfParents(false);
+        m_nameIndex = std::move(other.m_nameIndex);
+
         for (auto& widget : m_widgets)
             widget->setParent(this);
 
         other.m_widgets = {};
+        other.m_widgetNames = {};
+        other.m_nameIndex = {};
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -90,10 +151,16 @@ namespace tgui
         // Make sure it is not the same widget
         if (this != &right)
         {
+            // The container is still one of the widgets of its parent, the parent has to keep track of the new child widgets
+            Container* const parent = m_parent;
             Widget::operator=(right);
+            m_parent = parent;
 
             m_widgetBelowMouse = nullptr;
+            m_widgetWithLeftMouseDown = nullptr;
             m_focusedWidget = 0;
+            m_layerCached = right.m_layerCached;
+            m_layerInvalid = true;
 
             // Remove all the old widgets
             removeAllWidgets();
@@ -116,17 +183,36 @@ namespace tgui
         // Make sure it is not the same widget
         if (this != &right)
         {
+            // The container is still one of the widgets of its parent, the parent has to keep track of the new child widgets
+            Container* const parent = m_parent;
             Widget::operator=(std::move(right));
-            m_widgets              = std::move(right.m_widgets);
-            m_widgetNames          = std::move(right.m_widgetNames);
-            m_widgetBelowMouse     = std::move(right.m_widgetBelowMouse);
-            m_focusedWidget        = std::move(right.m_focusedWidget);
-            m_handingMouseReleased = std::move(right.m_handingMouseReleased);
+            m_parent = parent;
+
+            // Remove the old widgets, the named widgets of the other container no longer belong to the parents of that container
+            removeAllWidgets();
+            right.updateNameIndexOfParents(false);
+
+            m_widgets                 = std::move(right.m_widgets);
+            m_widgetNames             = std::move(right.m_widgetNames);
+            m_nameIndex               = std::move(right.m_nameIndex);
+            m_widgetBelowMouse        = std::move(right.m_widgetBelowMouse);
+            m_widgetWithLeftMouseDown = std::move(right.m_widgetWithLeftMouseDown);
+            m_focusedWidget           = std::move(right.m_focusedWidget);
+            m_handingMouseReleased    = std::move(right.m_handingMouseReleased);
+            m_layerCached             = std::move(right.m_layerCached);
+            m_layerInvalid            = true;
+            m_layerTexture            = std::move(right.m_layerTexture);
+            m_layerSize               = std::move(right.m_layerSize);
+            m_hitTestGridValid        = false;
 
             for (auto& widget : m_widgets)
                 widget->setParent(this);
 
+            updateNameIndexOfParents(true);
+
             right.m_widgets = {};
+            right.m_widgetNames = {};
+            right.m_nameIndex = {};
         }
 
         return *this;
@@ -154,8 +240,12 @@ namespace tgui
             widgetPtr->getRenderer()->setFont(m_fontCached);
 
         widgetPtr->setParent(this);
+        widgetPtr->m_orderInParent = m_widgets.empty() ? 0 : m_widgets.back()->m_orderInParent + 1;
         m_widgets.push_back(widgetPtr);
         m_widgetNames.push_back(widgetName);
+        updateNameIndex(widgetPtr.get(), widgetName, true);
+        m_hitTestGridValid = false;
+        invalidate();
 
         if (m_opacityCached < 1)
             widgetPtr->getRenderer()->setOpacity(m_opacityCached);
@@ -165,6 +255,41 @@ namespace tgui
 
     Widget::Ptr Container::get(const sf::String& widgetName) const
     {
+        if (!widgetName.isEmpty())
+        {
+            const std::string key = toNameKey(widgetName);
+            const auto it = m_nameIndex.find(key);
+            if (it != m_nameIndex.end())
+                return it->second.front()->shared_from_this();
+
+            // Try to interpret the name as a path, where each next part is the name of a child of the previous widget
+            const auto separator = key.find('.');
+            if ((separator == std::string::npos) || (separator == 0))
+                return nullptr;
+
+            const auto firstIt = m_nameIndex.find(key.substr(0, separator));
+            if (firstIt == m_nameIndex.end())
+                return nullptr;
+
+            Widget* widget = firstIt->second.front();
+            std::size_t partStart = separator + 1;
+            while (widget)
+            {
+                if (!widget->m_containerWidget)
+                    return nullptr;
+
+                const auto partEnd = std::min(key.find('.', partStart), key.length());
+                widget = static_cast<const Container*>(widget)->getDirectChild(key.substr(partStart, partEnd - partStart));
+                if (partEnd == key.length())
+                    break;
+
+                partStart = partEnd + 1;
+            }
+
+            return widget ? widget->shared_from_this() : nullptr;
+        }
+
+        // Widgets without a name aren't indexed
         for (std::size_t i = 0; i < m_widgetNames.size(); ++i)
         {
             if (m_widgetNames[i] == widgetName)
@@ -200,6 +325,9 @@ namespace tgui
                     m_widgetBelowMouse = nullptr;
                 }
 
+                if (m_widgetWithLeftMouseDown == widget)
+                    m_widgetWithLeftMouseDown = nullptr;
+
                 // Unfocus the widget if it was focused
                 if (m_focusedWidget == i+1)
                     unfocusWidgets();
@@ -209,9 +337,12 @@ namespace tgui
                     m_focusedWidget--;
 
                 // Remove the widget
+                updateNameIndex(widget.get(), m_widgetNames[i], false);
                 widget->setParent(nullptr);
                 m_widgets.erase(m_widgets.begin() + i);
                 m_widgetNames.erase(m_widgetNames.begin() + i);
+                m_hitTestGridValid = false;
+                invalidate();
                 return true;
             }
         }
@@ -223,15 +354,21 @@ namespace tgui
 
     void Container::removeAllWidgets()
     {
-        for (const auto& widget : m_widgets)
-            widget->setParent(nullptr);
+        for (std::size_t i = 0; i < m_widgets.size(); ++i)
+        {
+            updateNameIndex(m_widgets[i].get(), m_widgetNames[i], false);
+            m_widgets[i]->setParent(nullptr);
+        }
 
         // Clear the lists
         m_widgets.clear();
         m_widgetNames.clear();
 
         m_widgetBelowMouse = nullptr;
+        m_widgetWithLeftMouseDown = nullptr;
         m_focusedWidget = 0;
+        m_hitTestGridValid = false;
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -242,7 +379,14 @@ namespace tgui
         {
             if (m_widgets[i] == widget)
             {
+                if (!m_widgetNames[i].isEmpty())
+                    changeNameIndexEntry(toNameKey(m_widgetNames[i]), widget.get(), false);
+
                 m_widgetNames[i] = name;
+
+                if (!m_widgetNames[i].isEmpty())
+                    changeNameIndexEntry(toNameKey(m_widgetNames[i]), widget.get(), true);
+
                 return true;
             }
         }
@@ -436,6 +580,33 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Container::setLayerCached(bool cached)
+    {
+        m_layerCached = cached;
+        m_layerInvalid = true;
+
+        // Release the memory of the layer when it is no longer used
+        if (!m_layerCached)
+            m_layerTexture = nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Container::isLayerCached() const
+    {
+        return m_layerCached;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::invalidate()
+    {
+        m_layerInvalid = true;
+        Widget::invalidate();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Container::loadWidgetsFromFile(const std::string& filename)
     {
         std::ifstream in{filename};
@@ -506,6 +677,9 @@ namespace tgui
                 m_widgets.erase(m_widgets.begin() + i);
                 m_widgetNames.erase(m_widgetNames.begin() + i);
 
+                updateWidgetOrder(m_widgets.size() - 1);
+                m_hitTestGridValid = false;
+                invalidate();
                 break;
             }
         }
@@ -537,6 +711,9 @@ namespace tgui
                 m_widgets.erase(m_widgets.begin() + i + 1);
                 m_widgetNames.erase(m_widgetNames.begin() + i + 1);
 
+                updateWidgetOrder(0);
+                m_hitTestGridValid = false;
+                invalidate();
                 break;
             }
         }
@@ -642,8 +819,9 @@ namespace tgui
     {
         Widget::mouseNoLongerDown();
 
-        for (auto& widget : m_widgets)
-            widget->mouseNoLongerDown();
+        // Only the child on which the mouse went down can still think that the mouse is down
+        if (m_widgetWithLeftMouseDown)
+            m_widgetWithLeftMouseDown->mouseNoLongerDown();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -719,6 +897,21 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    sf::Time Container::timeUntilNextUpdate() const
+    {
+        sf::Time time = Widget::timeUntilNextUpdate();
+        for (const auto& widget : m_widgets)
+        {
+            // Hidden widgets aren't updated
+            if (widget->isVisible())
+                time = std::min(time, widget->timeUntilNextUpdate());
+        }
+
+        return time;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     bool Container::handleEvent(sf::Event& event)
     {
         // Check if a mouse button has moved
@@ -730,19 +923,12 @@ namespace tgui
             else
                 mousePos = {static_cast<float>(event.touch.x), static_cast<float>(event.touch.y)};
 
-            // Loop through all widgets
-            for (auto& widget : m_widgets)
+            // Some widgets should always receive mouse move events while dragging them, even if the mouse is no longer on top of them.
+            if (m_widgetWithLeftMouseDown && m_widgetWithLeftMouseDown->m_mouseDown
+             && (m_widgetWithLeftMouseDown->m_draggableWidget || m_widgetWithLeftMouseDown->m_containerWidget))
             {
-                // Check if the mouse went down on the widget
-                if (widget->m_mouseDown)
-                {
-                    // Some widgets should always receive mouse move events while dragging them, even if the mouse is no longer on top of them.
-                    if ((widget->m_draggableWidget) || (widget->m_containerWidget))
-                    {
-                        widget->mouseMoved(mousePos);
-                        return true;
-                    }
-                }
+                m_widgetWithLeftMouseDown->mouseMoved(mousePos);
+                return true;
             }
 
             // Check if the mouse is on top of a widget
@@ -769,6 +955,14 @@ namespace tgui
 
             // Check if the mouse is on top of a widget
             Widget::Ptr widget = mouseOnWhichWidget(mousePos);
+
+            // The widget on which the mouse went down the previous time is told again that the mouse is no longer down on it,
+            // which e.g. lets a menu bar close its open menu when clicking somewhere else.
+            if (m_widgetWithLeftMouseDown && (m_widgetWithLeftMouseDown != widget))
+                m_widgetWithLeftMouseDown->mouseNoLongerDown();
+
+            m_widgetWithLeftMouseDown = widget;
+
             if (widget != nullptr)
             {
                 // Focus the widget
@@ -810,14 +1004,11 @@ namespace tgui
             if (widgetBelowMouse != nullptr)
                 widgetBelowMouse->leftMouseReleased(mousePos);
 
-            // Tell all widgets that the mouse has gone up
+            // Tell the widget on which the mouse went down that the mouse has gone up, it will pass this on to its child widgets
             // But don't do this when leftMouseReleased was called on this container because
             // it will happen afterwards when mouseNoLongerDown is called on it
-            if (!m_handingMouseReleased)
-            {
-                for (auto& widget : m_widgets)
-                    widget->mouseNoLongerDown();
-            }
+            if (!m_handingMouseReleased && m_widgetWithLeftMouseDown)
+                m_widgetWithLeftMouseDown->mouseNoLongerDown();
 
             if (widgetBelowMouse != nullptr)
                 return true;
@@ -1025,18 +1216,51 @@ namespace tgui
 
     Widget::Ptr Container::mouseOnWhichWidget(sf::Vector2f mousePos)
     {
+        // The front most visible widget below the mouse is found, but it is only returned when it is enabled
         Widget::Ptr widget = nullptr;
-        for (auto it = m_widgets.rbegin(); it != m_widgets.rend(); ++it)
-        {
-            if ((*it)->isVisible())
+        const auto checkWidget = [&widget,mousePos](const Widget::Ptr& child)
             {
-                if ((*it)->mouseOnWidget(mousePos))
-                {
-                    if ((*it)->isEnabled())
-                        widget = *it;
+                if (!child->isVisible() || !child->mouseOnWidget(mousePos))
+                    return false;
+
+                if (child->isEnabled())
+                    widget = child;
 
+                return true;
+            };
+
+        if (m_widgets.size() < MinWidgetsForHitTestGrid)
+        {
+            for (auto it = m_widgets.rbegin(); it != m_widgets.rend(); ++it)
+            {
+                if (checkWidget(*it))
+                    break;
+            }
+        }
+        else
+        {
+            if (!m_hitTestGridValid)
+                rebuildHitTestGrid();
+
+            const std::size_t column = findHitTestCell(mousePos.x, m_hitTestGridOrigin.x, m_hitTestCellSize.x, m_hitTestColumns);
+            const std::size_t row = findHitTestCell(mousePos.y, m_hitTestGridOrigin.y, m_hitTestCellSize.y, m_hitTestRows);
+            const std::size_t cell = (row * m_hitTestColumns) + column;
+
+            // Both lists are sorted from back to front, so merge them while walking backwards to keep the order of the widgets
+            const std::size_t cellBegin = m_hitTestCellStarts[cell];
+            std::size_t cellIndex = m_hitTestCellStarts[cell + 1];
+            std::size_t unboundedIndex = m_hitTestUnboundedWidgets.size();
+            while ((cellIndex > cellBegin) || (unboundedIndex > 0))
+            {
+                std::size_t widgetIndex;
+                if ((unboundedIndex == 0)
+                 || ((cellIndex > cellBegin) && (m_hitTestCellWidgets[cellIndex - 1] > m_hitTestUnboundedWidgets[unboundedIndex - 1])))
+                    widgetIndex = m_hitTestCellWidgets[--cellIndex];
+                else
+                    widgetIndex = m_hitTestUnboundedWidgets[--unboundedIndex];
+
+                if (checkWidget(m_widgets[widgetIndex]))
                     break;
-                }
             }
         }
 
@@ -1050,14 +1274,360 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Container::rebuildHitTestGrid()
+    {
+        struct HitArea
+        {
+            std::size_t widgetIndex;
+            float left;
+            float top;
+            float right;
+            float bottom;
+        };
+
+        m_hitTestGridValid = true;
+        m_hitTestUnboundedWidgets.clear();
+
+        // Find the area in which the mouse can be on top of each visible widget, which includes e.g. the text of a check box
+        std::vector<HitArea> areas;
+        areas.reserve(m_widgets.size());
+        sf::Vector2f minPos{std::numeric_limits<float>::max(), std::numeric_limits<float>::max()};
+        sf::Vector2f maxPos{std::numeric_limits<float>::lowest(), std::numeric_limits<float>::lowest()};
+        for (std::size_t i = 0; i < m_widgets.size(); ++i)
+        {
+            const auto& widget = m_widgets[i];
+            if (!widget->isVisible())
+                continue;
+
+            if (!widget->m_hitAreaInFullSize)
+            {
+                m_hitTestUnboundedWidgets.push_back(i);
+                continue;
+            }
+
+            const sf::Vector2f position = widget->getPosition();
+            const sf::Vector2f size = widget->getSize();
+            const sf::Vector2f fullPosition = position + widget->getWidgetOffset();
+            const sf::Vector2f fullSize = widget->getFullSize();
+
+            HitArea area;
+            area.widgetIndex = i;
+            area.left = std::min({position.x, position.x + size.x, fullPosition.x, fullPosition.x + fullSize.x});
+            area.top = std::min({position.y, position.y + size.y, fullPosition.y, fullPosition.y + fullSize.y});
+            area.right = std::max({position.x, position.x + size.x, fullPosition.x, fullPosition.x + fullSize.x});
+            area.bottom = std::max({position.y, position.y + size.y, fullPosition.y, fullPosition.y + fullSize.y});
+            areas.push_back(area);
+
+            minPos.x = std::min(minPos.x, area.left);
+            minPos.y = std::min(minPos.y, area.top);
+            maxPos.x = std::max(maxPos.x, area.right);
+            maxPos.y = std::max(maxPos.y, area.bottom);
+        }
+
+        // Use about as many cells as there are widgets
+        const auto cellsPerSide = static_cast<std::size_t>(std::ceil(std::sqrt(static_cast<float>(areas.size()))));
+        m_hitTestColumns = std::max<std::size_t>(1, std::min(cellsPerSide, MaxHitTestGridCells));
+        m_hitTestRows = m_hitTestColumns;
+        if (areas.empty())
+        {
+            minPos = {0, 0};
+            maxPos = {0, 0};
+        }
+
+        m_hitTestGridOrigin = minPos;
+        m_hitTestCellSize = {(maxPos.x - minPos.x) / m_hitTestColumns, (maxPos.y - minPos.y) / m_hitTestRows};
+        if (!(m_hitTestCellSize.x > 0))
+        {
+            m_hitTestColumns = 1;
+            m_hitTestCellSize.x = 1;
+        }
+        if (!(m_hitTestCellSize.y > 0))
+        {
+            m_hitTestRows = 1;
+            m_hitTestCellSize.y = 1;
+        }
+
+        // Count how many widgets overlap with each cell and then fill the cells. The widgets are added from back to front.
+        m_hitTestCellStarts.assign((m_hitTestColumns * m_hitTestRows) + 1, 0);
+        for (int pass = 0; pass < 2; ++pass)
+        {
+            if (pass == 1)
+            {
+                for (std::size_t cell = 1; cell + 1 < m_hitTestCellStarts.size(); ++cell)
+                    m_hitTestCellStarts[cell] += m_hitTestCellStarts[cell - 1];
+
+                m_hitTestCellStarts.back() = m_hitTestCellStarts[m_hitTestCellStarts.size() - 2];
+                m_hitTestCellWidgets.resize(m_hitTestCellStarts.back());
+            }
+
+            for (auto it = areas.rbegin(); it != areas.rend(); ++it)
+            {
+                const std::size_t firstColumn = findHitTestCell(it->left, m_hitTestGridOrigin.x, m_hitTestCellSize.x, m_hitTestColumns);
+                const std::size_t lastColumn = findHitTestCell(it->right, m_hitTestGridOrigin.x, m_hitTestCellSize.x, m_hitTestColumns);
+                const std::size_t firstRow = findHitTestCell(it->top, m_hitTestGridOrigin.y, m_hitTestCellSize.y, m_hitTestRows);
+                const std::size_t lastRow = findHitTestCell(it->bottom, m_hitTestGridOrigin.y, m_hitTestCellSize.y, m_hitTestRows);
+                for (std::size_t row = firstRow; row <= lastRow; ++row)
+                {
+                    for (std::size_t column = firstColumn; column <= lastColumn; ++column)
+                    {
+                        // After counting, the cell start temporarily points to the end of the cell and the cell is filled from the back
+                        const std::size_t cell = (row * m_hitTestColumns) + column;
+                        if (pass == 0)
+                            ++m_hitTestCellStarts[cell];
+                        else
+                            m_hitTestCellWidgets[--m_hitTestCellStarts[cell]] = it->widgetIndex;
+                    }
+                }
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::updateNameIndex(Widget* widget, const sf::String& widgetName, bool added)
+    {
+        if (!widgetName.isEmpty())
+            changeNameIndexEntry(toNameKey(widgetName), widget, added);
+
+        // The widgets inside a child container are also part of the index of this container
+        if (widget->m_containerWidget)
+        {
+            for (const auto& pair : static_cast<Container*>(widget)->m_nameIndex)
+            {
+                for (Widget* childWidget : pair.second)
+                    changeNameIndexEntry(pair.first, childWidget, added);
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::updateNameIndexOfParents(bool added)
+    {
+        if (!m_parent)
+            return;
+
+        for (const auto& pair : m_nameIndex)
+        {
+            for (Widget* widget : pair.second)
+                m_parent->changeNameIndexEntry(pair.first, widget, added);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::changeNameIndexEntry(const std::string& key, Widget* widget, bool added)
+    {
+        for (Container* container = this; container != nullptr; container = container->getParent())
+        {
+            if (added)
+            {
+                // The widgets are kept in the order in which the recursive search would find them
+                auto& widgets = container->m_nameIndex[key];
+                widgets.insert(std::upper_bound(widgets.begin(), widgets.end(), widget,
+                                                [container](const Widget* left, const Widget* right){ return container->isBeforeInTreeOrder(left, right); }),
+                               widget);
+            }
+            else
+            {
+                const auto it = container->m_nameIndex.find(key);
+                if (it == container->m_nameIndex.end())
+                    continue;
+
+                auto& widgets = it->second;
+                widgets.erase(std::remove(widgets.begin(), widgets.end(), widget), widgets.end());
+                if (widgets.empty())
+                    container->m_nameIndex.erase(it);
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Container::isBeforeInTreeOrder(const Widget* left, const Widget* right) const
+    {
+        // Find the widgets on the way from this container to both widgets
+        const auto findPath = [this](const Widget* widget)
+            {
+                std::vector<const Widget*> path{widget};
+                while (path.back()->getParent() != this)
+                    path.push_back(path.back()->getParent());
+
+                std::reverse(path.begin(), path.end());
+                return path;
+            };
+
+        const std::vector<const Widget*> leftPath = findPath(left);
+        const std::vector<const Widget*> rightPath = findPath(right);
+
+        // In each container, the direct children come before the widgets inside its child containers
+        for (std::size_t i = 0; (i < leftPath.size()) && (i < rightPath.size()); ++i)
+        {
+            const bool leftIsChild = (i + 1 == leftPath.size());
+            const bool rightIsChild = (i + 1 == rightPath.size());
+            if (leftIsChild != rightIsChild)
+                return leftIsChild;
+
+            if (leftPath[i] != rightPath[i])
+                return leftPath[i]->m_orderInParent < rightPath[i]->m_orderInParent;
+        }
+
+        return false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::updateWidgetOrder(std::size_t index)
+    {
+        // The named widgets inside the moved widget have to be put on their new place in the name index
+        Widget* const widget = m_widgets[index].get();
+        updateNameIndex(widget, m_widgetNames[index], false);
+
+        for (std::size_t i = 0; i < m_widgets.size(); ++i)
+            m_widgets[i]->m_orderInParent = i;
+
+        updateNameIndex(widget, m_widgetNames[index], true);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Widget* Container::getDirectChild(const std::string& key) const
+    {
+        const auto it = m_nameIndex.find(key);
+        if (it == m_nameIndex.end())
+            return nullptr;
+
+        // The direct children are stored in front of the widgets inside child containers
+        Widget* const widget = it->second.front();
+        if (widget->getParent() == this)
+            return widget;
+        else
+            return nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Container::drawWidgetContainer(sf::RenderTarget* target, const sf::RenderStates& states) const
     {
-        // Draw all widgets when they are visible
-        for (const auto& widget : m_widgets)
+        if (m_layerCached && drawCachedLayer(*target, states))
+            return;
+
+        drawChildWidgets(*target, states);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::drawChildWidgets(sf::RenderTarget& target, const sf::RenderStates& states) const
+    {
+        RenderStatistics* statistics = RenderStatistics::getActive();
+
+        // Draw all widgets when they are visible and not located outside the clipping area
+        for (std::size_t i = 0; i < m_widgets.size(); ++i)
         {
-            if (widget->isVisible())
-                widget->draw(*target, states);
+            const Widget::Ptr& widget = m_widgets[i];
+            if (!widget->isVisible())
+                continue;
+
+            if (!Clipping::isVisible(target, states, widget->getDrawBounds()))
+            {
+                if (statistics)
+                    ++statistics->widgetsCulled;
+
+                continue;
+            }
+
+            if (statistics)
+            {
+                ++statistics->widgetsVisited;
+
+                // The time is only measured for the widgets that were added directly to the gui
+                if (!m_parent)
+                {
+                    sf::Clock clock;
+                    widget->draw(target, states);
+                    statistics->widgetTimes.push_back({widget, m_widgetNames[i], widget->getWidgetType(), clock.getElapsedTime()});
+                    continue;
+                }
+            }
+
+            widget->draw(target, states);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Container::drawCachedLayer(sf::RenderTarget& target, const sf::RenderStates& states) const
+    {
+        // The layer covers the area in which the child widgets can be seen
+        const sf::Vector2f contentSize = getContentSize();
+        const sf::Vector2i topLeft = target.mapCoordsToPixel(states.transform.transformPoint({0, 0}));
+        const sf::Vector2i bottomRight = target.mapCoordsToPixel(states.transform.transformPoint(contentSize));
+        const sf::Vector2u pixelSize{static_cast<unsigned int>(std::abs(bottomRight.x - topLeft.x)),
+                                     static_cast<unsigned int>(std::abs(bottomRight.y - topLeft.y))};
+        if ((pixelSize.x == 0) || (pixelSize.y == 0))
+            return false;
+
+        if (!m_layerTexture || (m_layerTexture->getSize() != pixelSize))
+        {
+            if (!m_layerTexture)
+                m_layerTexture = std::make_unique<sf::RenderTexture>();
+
+            if (!m_layerTexture->create(pixelSize.x, pixelSize.y))
+            {
+                m_layerTexture = nullptr;
+                return false;
+            }
+
+            m_layerInvalid = true;
         }
+
+        if (m_layerInvalid || (m_layerSize != contentSize))
+        {
+            // Geometry that was batched for the target has to be drawn while its context and clipping area are still active
+            DrawBatch::flush(target);
+
+            m_layerTexture->setActive(true);
+            m_layerTexture->setView(sf::View{{0, 0, contentSize.x, contentSize.y}});
+            m_layerTexture->clear(sf::Color::Transparent);
+
+            // The child widgets clip on the layer texture instead of on the target
+            ClippingStack clippingStack;
+            clippingStack.begin(*m_layerTexture);
+
+            {
+                std::unique_ptr<DrawBatch> batch;
+                if (DrawBatch::isBatching(target))
+                    batch = std::make_unique<DrawBatch>(*m_layerTexture);
+
+                drawChildWidgets(*m_layerTexture, sf::RenderStates::Default);
+            }
+
+            clippingStack.end();
+            m_layerTexture->display();
+
+            // The contexts of the layer and the target may be shared, so the clipping area of the target has to be set again
+            activateTarget(target);
+            if (ClippingStack* targetClippingStack = ClippingStack::getActive(target))
+                targetClippingStack->restore();
+
+            m_layerSize = contentSize;
+            m_layerInvalid = false;
+        }
+
+        // The widgets were drawn with alpha blending on a transparent texture, so the colors in the layer are premultiplied
+        sf::RenderStates layerStates = states;
+        layerStates.texture = &m_layerTexture->getTexture();
+        layerStates.blendMode = sf::BlendMode{sf::BlendMode::One, sf::BlendMode::OneMinusSrcAlpha};
+
+        const sf::Vertex vertices[] = {
+            {{0, 0}, {0, 0}},
+            {{0, contentSize.y}, {0, static_cast<float>(pixelSize.y)}},
+            {{contentSize.x, 0}, {static_cast<float>(pixelSize.x), 0}},
+            {{contentSize.x, contentSize.y}, {static_cast<float>(pixelSize.x), static_cast<float>(pixelSize.y)}}
+        };
+
+        DrawBatch::draw(target, vertices, 4, sf::PrimitiveType::TrianglesStrip, layerStates);
+        return true;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1083,6 +1653,14 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void GuiContainer::invalidate()
+    {
+        Container::invalidate();
+        m_redrawNeeded = true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void GuiContainer::draw(sf::RenderTarget&, sf::RenderStates) const
     {
     }
@@ -0,0 +1,260 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <TGUI/DrawBatch.hpp>
+#include <TGUI/RenderStatistics.hpp>
+#include <SFML/Graphics/Sprite.hpp>
+#include <SFML/Graphics/Text.hpp>
+#include <SFML/Graphics/Font.hpp>
+#if SFML_VERSION_MAJOR > 2 || (SFML_VERSION_MAJOR == 2 && SFML_VERSION_MINOR >= 5)
+    #include <SFML/Graphics/VertexBuffer.hpp>
+#endif
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    namespace
+    {
+        void countDrawCall(std::size_t vertexCount, const sf::Texture* texture)
+        {
+            if (RenderStatistics* statistics = RenderStatistics::getActive())
+                statistics->addDrawCall(vertexCount, texture);
+        }
+
+        // Sfml creates the vertices of these drawables internally, so the amount of vertices is calculated the same way
+        void countDrawCall(const sf::Drawable& drawable, const sf::RenderStates& states)
+        {
+            if (!RenderStatistics::getActive())
+                return;
+
+            if (const sf::Text* text = dynamic_cast<const sf::Text*>(&drawable))
+            {
+                // Each character is drawn as two triangles
+                const sf::Texture* texture = text->getFont() ? &text->getFont()->getTexture(text->getCharacterSize()) : nullptr;
+                countDrawCall(6 * text->getString().getSize(), texture);
+            }
+            else if (const sf::Sprite* sprite = dynamic_cast<const sf::Sprite*>(&drawable))
+                countDrawCall(4, sprite->getTexture());
+        #if SFML_VERSION_MAJOR > 2 || (SFML_VERSION_MAJOR == 2 && SFML_VERSION_MINOR >= 5)
+            else if (const sf::VertexBuffer* vertexBuffer = dynamic_cast<const sf::VertexBuffer*>(&drawable))
+                countDrawCall(vertexBuffer->getVertexCount(), states.texture);
+        #endif
+            else
+                countDrawCall(0, nullptr);
+        }
+
+        void countDrawCall(const sf::Shape& shape)
+        {
+            if (!RenderStatistics::getActive())
+                return;
+
+            // The fill is drawn as a fan around the center and the outline as a strip in a separate draw call
+            countDrawCall(shape.getPointCount() + 2, shape.getTexture());
+            if (shape.getOutlineThickness() != 0)
+                countDrawCall(2 * (shape.getPointCount() + 1), nullptr);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    DrawBatch* DrawBatch::m_activeBatch = nullptr;
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    DrawBatch::DrawBatch(sf::RenderTarget& target) :
+        m_target       {target},
+        m_previousBatch{m_activeBatch}
+    {
+        // Anything that was still waiting in the outer batch has to be drawn before our geometry
+        if (m_previousBatch)
+            m_previousBatch->flushBatch();
+
+        m_activeBatch = this;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    DrawBatch::~DrawBatch()
+    {
+        flushBatch();
+        m_activeBatch = m_previousBatch;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void DrawBatch::draw(sf::RenderTarget& target, const sf::Vertex* vertices, std::size_t vertexCount, sf::PrimitiveType type, const sf::RenderStates& states)
+    {
+        DrawBatch* batch = getBatch(target);
+        if (!batch || ((type != sf::PrimitiveType::Triangles) && (type != sf::PrimitiveType::TrianglesStrip) && (type != sf::PrimitiveType::TrianglesFan)))
+        {
+            flush(target);
+            target.draw(vertices, vertexCount, type, states);
+            countDrawCall(vertexCount, states.texture);
+            return;
+        }
+
+        if (vertexCount < 3)
+            return;
+
+        batch->prepare(states);
+
+        const auto addVertex = [&](const sf::Vertex& vertex)
+            {
+                batch->m_vertices.emplace_back(states.transform.transformPoint(vertex.position), vertex.color, vertex.texCoords);
+            };
+
+        if (type == sf::PrimitiveType::Triangles)
+        {
+            batch->m_vertices.reserve(batch->m_vertices.size() + vertexCount);
+            for (std::size_t i = 0; i < vertexCount - (vertexCount % 3); ++i)
+                addVertex(vertices[i]);
+        }
+        else if (type == sf::PrimitiveType::TrianglesStrip)
+        {
+            batch->m_vertices.reserve(batch->m_vertices.size() + 3 * (vertexCount - 2));
+            for (std::size_t i = 2; i < vertexCount; ++i)
+            {
+                addVertex(vertices[i-2]);
+                addVertex(vertices[i-1]);
+                addVertex(vertices[i]);
+            }
+        }
+        else // TrianglesFan
+        {
+            batch->m_vertices.reserve(batch->m_vertices.size() + 3 * (vertexCount - 2));
+            for (std::size_t i = 2; i < vertexCount; ++i)
+            {
+                addVertex(vertices[0]);
+                addVertex(vertices[i-1]);
+                addVertex(vertices[i]);
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void DrawBatch::draw(sf::RenderTarget& target, const sf::Shape& shape, const sf::RenderStates& states)
+    {
+        DrawBatch* batch = getBatch(target);
+        if (!batch || shape.getTexture() || (shape.getOutlineThickness() != 0) || (shape.getPointCount() < 3))
+        {
+            flush(target);
+            target.draw(shape, states);
+            countDrawCall(shape);
+            return;
+        }
+
+        sf::RenderStates shapeStates = states;
+        shapeStates.transform *= shape.getTransform();
+        batch->prepare(shapeStates);
+
+        const sf::Color color = shape.getFillColor();
+        const std::size_t pointCount = shape.getPointCount();
+        const sf::Vector2f firstPoint = shapeStates.transform.transformPoint(shape.getPoint(0));
+        sf::Vector2f previousPoint = shapeStates.transform.transformPoint(shape.getPoint(1));
+
+        batch->m_vertices.reserve(batch->m_vertices.size() + 3 * (pointCount - 2));
+        for (std::size_t i = 2; i < pointCount; ++i)
+        {
+            const sf::Vector2f point = shapeStates.transform.transformPoint(shape.getPoint(i));
+            batch->m_vertices.emplace_back(firstPoint, color);
+            batch->m_vertices.emplace_back(previousPoint, color);
+            batch->m_vertices.emplace_back(point, color);
+            previousPoint = point;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void DrawBatch::draw(sf::RenderTarget& target, const sf::Drawable& drawable, const sf::RenderStates& states)
+    {
+        flush(target);
+        target.draw(drawable, states);
+        countDrawCall(drawable, states);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void DrawBatch::flush(const sf::RenderTarget& target)
+    {
+        DrawBatch* batch = getBatch(target);
+        if (batch)
+            batch->flushBatch();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool DrawBatch::isBatching(const sf::RenderTarget& target)
+    {
+        return getBatch(target) != nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    DrawBatch* DrawBatch::getBatch(const sf::RenderTarget& target)
+    {
+        if (m_activeBatch && (&m_activeBatch->m_target == &target))
+            return m_activeBatch;
+        else
+            return nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void DrawBatch::prepare(const sf::RenderStates& states)
+    {
+        if ((states.texture != m_texture) || (states.shader != m_shader) || !(states.blendMode == m_blendMode))
+        {
+            flushBatch();
+            m_texture = states.texture;
+            m_shader = states.shader;
+            m_blendMode = states.blendMode;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void DrawBatch::flushBatch()
+    {
+        if (m_vertices.empty())
+            return;
+
+        sf::RenderStates states;
+        states.texture = m_texture;
+        states.shader = m_shader;
+        states.blendMode = m_blendMode;
+        m_target.draw(m_vertices.data(), m_vertices.size(), sf::PrimitiveType::Triangles, states);
+        countDrawCall(m_vertices.size(), m_texture);
+
+        // Keep the allocated memory around for the next batch
+        m_vertices.clear();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -24,6 +24,7 @@
 
 
 #include <TGUI/Font.hpp>
+#include <TGUI/FontMetrics.hpp>
 #include <TGUI/Loading/Deserializer.hpp>
 
 #include <cassert>
@@ -128,7 +129,7 @@ namespace tgui
     float Font::getKerning(sf::Uint32 first, sf::Uint32 second, unsigned int characterSize) const
     {
         if (m_font)
-            return m_font->getKerning(first, second, characterSize);
+            return FontMetrics::get(m_font, characterSize, false).getKerning(first, second);
         else
             return 0;
     }
@@ -138,12 +139,35 @@ namespace tgui
     float Font::getLineSpacing(unsigned int characterSize) const
     {
         if (m_font)
-            return m_font->getLineSpacing(characterSize);
+            return FontMetrics::get(m_font, characterSize, false).getLineSpacing();
         else
             return 0;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Font::preloadGlyphs(const sf::String& characters, unsigned int characterSize, bool bold) const
+    {
+        if (!m_font)
+            return;
+
+        sf::String codePoints = characters;
+        if (codePoints.isEmpty())
+        {
+            for (sf::Uint32 c = 32; c < 127; ++c)
+                codePoints += c;
+        }
+
+        // Getting the glyph renders it to the texture of the font, the metrics are filled in at the same time
+        const FontMetrics& metrics = FontMetrics::get(m_font, characterSize, bold);
+        for (const sf::Uint32 c : codePoints)
+        {
+            m_font->getGlyph(c, characterSize, bold);
+            metrics.getAdvance(c);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,174 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <TGUI/FontManager.hpp>
+#include <TGUI/DefaultFont.hpp>
+#include <TGUI/MappedFile.hpp>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    namespace
+    {
+        // Font that reads its data from a memory-mapped file, the font is destroyed before the file is unmapped
+        struct MappedFont
+        {
+            MappedFile file;
+            sf::Font font;
+        };
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::map<std::string, std::weak_ptr<sf::Font>> FontManager::m_fonts;
+    std::weak_ptr<sf::Font> FontManager::m_defaultFont;
+    bool FontManager::m_memoryMappingEnabled = false;
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::shared_ptr<sf::Font> FontManager::getFont(const std::string& filename)
+    {
+        const std::string path = normalizePath(filename);
+
+        // Reuse the font when it was already loaded and is still being used
+        const auto it = m_fonts.find(path);
+        if (it != m_fonts.end())
+        {
+            if (auto font = it->second.lock())
+                return font;
+        }
+
+        std::shared_ptr<sf::Font> font;
+        if (m_memoryMappingEnabled)
+        {
+            auto mappedFont = std::make_shared<MappedFont>();
+            if (mappedFont->file.open(filename) && mappedFont->file.isMapped()
+             && mappedFont->font.loadFromMemory(mappedFont->file.getData(), mappedFont->file.getSize()))
+                font = std::shared_ptr<sf::Font>(mappedFont, &mappedFont->font);
+        }
+
+        if (!font)
+        {
+            font = std::make_shared<sf::Font>();
+            if (!font->loadFromFile(filename))
+                return nullptr;
+        }
+
+        // Forget about the fonts that are no longer used by anyone
+        for (auto fontIt = m_fonts.begin(); fontIt != m_fonts.end();)
+        {
+            if (fontIt->second.expired())
+                fontIt = m_fonts.erase(fontIt);
+            else
+                ++fontIt;
+        }
+
+        m_fonts[path] = font;
+        return font;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::shared_ptr<sf::Font> FontManager::getDefaultFont()
+    {
+        if (auto font = m_defaultFont.lock())
+            return font;
+
+        // The font data is part of the executable, so sfml can read from it directly without making a copy
+        auto font = std::make_shared<sf::Font>();
+        if (!font->loadFromMemory(defaultFontBytes, sizeof(defaultFontBytes)))
+            return nullptr;
+
+        m_defaultFont = font;
+        return font;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void FontManager::setMemoryMappingEnabled(bool enabled)
+    {
+        m_memoryMappingEnabled = enabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool FontManager::isMemoryMappingEnabled()
+    {
+        return m_memoryMappingEnabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::string FontManager::normalizePath(const std::string& filename)
+    {
+        std::string path = filename;
+        for (auto& c : path)
+        {
+            if (c == '\\')
+                c = '/';
+        }
+
+        const bool absolute = !path.empty() && (path[0] == '/');
+
+        std::vector<std::string> parts;
+        std::size_t start = 0;
+        while (start <= path.length())
+        {
+            std::size_t end = path.find('/', start);
+            if (end == std::string::npos)
+                end = path.length();
+
+            const std::string part = path.substr(start, end - start);
+            if (part == "..")
+            {
+                // A drive letter can't be left and a relative path can start with ".."
+                if (!parts.empty() && (parts.back() != "..") && (parts.back().back() != ':'))
+                    parts.pop_back();
+                else if (!absolute && (parts.empty() || (parts.back() == "..")))
+                    parts.push_back(part);
+            }
+            else if (!part.empty() && (part != "."))
+                parts.push_back(part);
+
+            start = end + 1;
+        }
+
+        std::string result = absolute ? "/" : "";
+        for (std::size_t i = 0; i < parts.size(); ++i)
+        {
+            if (i > 0)
+                result += '/';
+            result += parts[i];
+        }
+
+        return result;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
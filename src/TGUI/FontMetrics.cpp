@@ -0,0 +1,165 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <TGUI/FontMetrics.hpp>
+
+#include <cassert>
+#include <cmath>
+#include <limits>
+#include <map>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    namespace
+    {
+        struct FontMetricsEntry
+        {
+            // Used to find out whether the font still exists, a new font could be created at the same address
+            std::weak_ptr<sf::Font> font;
+
+            // Metrics per character size and boldness
+            std::map<std::pair<unsigned int, bool>, std::unique_ptr<FontMetrics>> metrics;
+        };
+
+        std::map<const sf::Font*, FontMetricsEntry>& getFontMetricsCache()
+        {
+            static std::map<const sf::Font*, FontMetricsEntry> cache;
+            return cache;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const FontMetrics& FontMetrics::get(const std::shared_ptr<sf::Font>& font, unsigned int characterSize, bool bold)
+    {
+        assert(font != nullptr);
+
+        auto& cache = getFontMetricsCache();
+        auto entryIt = cache.find(font.get());
+        if ((entryIt != cache.end()) && entryIt->second.font.expired())
+        {
+            cache.erase(entryIt);
+            entryIt = cache.end();
+        }
+
+        if (entryIt == cache.end())
+        {
+            // Remove the metrics of fonts that no longer exist before a new font is added
+            for (auto it = cache.begin(); it != cache.end();)
+            {
+                if (it->second.font.expired())
+                    it = cache.erase(it);
+                else
+                    ++it;
+            }
+
+            entryIt = cache.emplace(font.get(), FontMetricsEntry{font, {}}).first;
+        }
+
+        auto& metrics = entryIt->second.metrics[std::make_pair(characterSize, bold)];
+        if (!metrics)
+            metrics = std::unique_ptr<FontMetrics>(new FontMetrics(*font, characterSize, bold));
+
+        return *metrics;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void FontMetrics::invalidate(const sf::Font& font)
+    {
+        getFontMetricsCache().erase(&font);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    FontMetrics::FontMetrics(const sf::Font& font, unsigned int characterSize, bool bold) :
+        m_font         {font},
+        m_characterSize{characterSize},
+        m_bold         {bold}
+    {
+        m_lineSpacing = m_font.getLineSpacing(m_characterSize);
+
+        // The first line is as high as the part above the baseline (the character size) plus the part of a 'g' below it
+        const sf::FloatRect bounds = m_font.getGlyph('g', m_characterSize, m_bold).bounds;
+        m_extraVerticalSpace = m_characterSize + bounds.height + bounds.top - m_lineSpacing;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    float FontMetrics::loadAdvance(sf::Uint32 codePoint) const
+    {
+        if (codePoint < DenseRangeSize)
+        {
+            m_denseAdvances[codePoint] = m_font.getGlyph(codePoint, m_characterSize, m_bold).advance;
+            m_denseAdvancesCached[codePoint] = true;
+            return m_denseAdvances[codePoint];
+        }
+
+        const auto it = m_advances.find(codePoint);
+        if (it != m_advances.end())
+            return it->second;
+
+        const float advance = m_font.getGlyph(codePoint, m_characterSize, m_bold).advance;
+        m_advances[codePoint] = advance;
+        return advance;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    float FontMetrics::getKerning(sf::Uint32 first, sf::Uint32 second) const
+    {
+        // The font never applies kerning at the start of the text
+        if ((first == 0) || (second == 0))
+            return 0;
+
+        if ((first - KerningTableFirst < KerningTableSize) && (second - KerningTableFirst < KerningTableSize))
+        {
+            if (m_kerningTable.empty())
+                m_kerningTable.assign(KerningTableSize * KerningTableSize, std::numeric_limits<float>::quiet_NaN());
+
+            float& kerning = m_kerningTable[(first - KerningTableFirst) * KerningTableSize + (second - KerningTableFirst)];
+            if (std::isnan(kerning))
+                kerning = m_font.getKerning(first, second, m_characterSize);
+
+            return kerning;
+        }
+
+        const sf::Uint64 key = (static_cast<sf::Uint64>(first) << 32) | second;
+        const auto it = m_kernings.find(key);
+        if (it != m_kernings.end())
+            return it->second;
+
+        const float kerning = m_font.getKerning(first, second, m_characterSize);
+        m_kernings[key] = kerning;
+        return kerning;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -23,13 +23,14 @@
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 #include <TGUI/Gui.hpp>
-#include <TGUI/DefaultFont.hpp>
+#include <TGUI/FontManager.hpp>
 #include <TGUI/Clipboard.hpp>
 #include <TGUI/ToolTip.hpp>
+#include <TGUI/DrawBatch.hpp>
 
 #include <SFML/Graphics/RenderTexture.hpp>
-#include <SFML/OpenGL.hpp>
 
+#include <algorithm>
 #include <cassert>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -48,8 +49,8 @@ namespace tgui
     {
         m_container->m_focused = true;
 
-        auto defaultFont = std::make_shared<sf::Font>();
-        if (defaultFont->loadFromMemory(defaultFontBytes, sizeof(defaultFontBytes)))
+        auto defaultFont = FontManager::getDefaultFont();
+        if (defaultFont)
             setFont(defaultFont);
     }
 
@@ -66,8 +67,8 @@ namespace tgui
 
         setView(window.getDefaultView());
 
-        auto defaultFont = std::make_shared<sf::Font>();
-        if (defaultFont->loadFromMemory(defaultFontBytes, sizeof(defaultFontBytes)))
+        auto defaultFont = FontManager::getDefaultFont();
+        if (defaultFont)
             setFont(defaultFont);
     }
 #endif
@@ -86,8 +87,8 @@ namespace tgui
 
         setView(target.getDefaultView());
 
-        auto defaultFont = std::make_shared<sf::Font>();
-        if (defaultFont->loadFromMemory(defaultFontBytes, sizeof(defaultFontBytes)))
+        auto defaultFont = FontManager::getDefaultFont();
+        if (defaultFont)
             setFont(defaultFont);
     }
 
@@ -97,6 +98,7 @@ namespace tgui
     void Gui::setTarget(sf::RenderWindow& window)
     {
         m_target = &window;
+        m_container->invalidate();
 
         m_accessToWindow = true;
         Clipboard::setWindowHandle(window.getSystemHandle());
@@ -114,6 +116,7 @@ namespace tgui
     #endif
 
         m_target = &target;
+        m_container->invalidate();
 
         setView(target.getDefaultView());
     }
@@ -142,6 +145,8 @@ namespace tgui
         }
         else // Set it anyway in case something changed that we didn't care to check
             m_view = view;
+
+        m_container->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -157,6 +162,50 @@ namespace tgui
     {
         assert(m_target != nullptr);
 
+        if (!m_eventQueueing)
+            return processEvent(event);
+
+        // A move event replaces the previous event when that one was also a move event, the newest position is all that matters
+        if (!m_queuedEvents.empty())
+        {
+            sf::Event& lastEvent = m_queuedEvents.back();
+            if ((event.type == sf::Event::MouseMoved) && (lastEvent.type == sf::Event::MouseMoved))
+            {
+                lastEvent = event;
+                return false;
+            }
+            else if ((event.type == sf::Event::TouchMoved) && (lastEvent.type == sf::Event::TouchMoved)
+                  && (event.touch.finger == lastEvent.touch.finger))
+            {
+                lastEvent = event;
+                return false;
+            }
+        }
+
+        m_queuedEvents.push_back(event);
+        return false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Gui::setEventQueueing(bool queued)
+    {
+        m_eventQueueing = queued;
+        if (!m_eventQueueing)
+            processQueuedEvents();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Gui::isEventQueueingEnabled() const
+    {
+        return m_eventQueueing;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Gui::processEvent(sf::Event event)
+    {
         // Check if the event has something to do with the mouse
         if ((event.type == sf::Event::MouseMoved) || (event.type == sf::Event::TouchMoved)
          || (event.type == sf::Event::MouseButtonPressed) || (event.type == sf::Event::TouchBegan)
@@ -227,6 +276,11 @@ namespace tgui
         {
             m_container->m_focused = false;
         }
+        else if (event.type == sf::Event::Resized)
+        {
+            // The contents of the window have to be drawn again
+            m_container->invalidate();
+        }
         else if (event.type == sf::Event::GainedFocus)
         {
             m_container->m_focused = true;
@@ -242,6 +296,20 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Gui::processQueuedEvents()
+    {
+        if (m_queuedEvents.empty())
+            return;
+
+        // Widgets may pass new events to the gui while handling an event, those will be handled during the next update
+        std::vector<sf::Event> events;
+        events.swap(m_queuedEvents);
+        for (const auto& event : events)
+            processEvent(event);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Gui::draw()
     {
         assert(m_target != nullptr);
@@ -257,43 +325,79 @@ namespace tgui
         m_target->setActive(true);
 #endif
 
+        // The queued events have to be handled even when the window isn't focused, as one of them may be a GainedFocus event
+        processQueuedEvents();
+
         // Update the time
         if (m_container->m_focused)
             updateTime(m_clock.restart());
         else
             m_clock.restart();
 
-        // Check if clipping is enabled
-        const GLboolean clippingEnabled = glIsEnabled(GL_SCISSOR_TEST);
-        GLint scissor[4];
-
-        if (clippingEnabled)
-        {
-            // Remember the old clipping area
-            glGetIntegerv(GL_SCISSOR_BOX, scissor);
-        }
-        else // Clipping was disabled
+        // Start counting what happens during this frame when requested
+        RenderStatistics* const oldStatistics = RenderStatistics::getActive();
+        if (m_renderStatisticsEnabled)
         {
-            // Enable clipping
-            glEnable(GL_SCISSOR_TEST);
-            glScissor(0, 0, m_target->getSize().x, m_target->getSize().y);
+            m_renderStatistics.reset();
+            RenderStatistics::setActive(&m_renderStatistics);
         }
 
+        // Clipping is tracked on the cpu while drawing, the whole target is visible until a widget clips
+        m_clippingStack.begin(*m_target);
+
         // Change the view
         const sf::View oldView = m_target->getView();
         m_target->setView(m_view);
 
+        // Changes made from now on will require the gui to be drawn again
+        m_container->m_redrawNeeded = false;
+
         // Draw the widgets
-        m_container->drawWidgetContainer(m_target, sf::RenderStates::Default);
+        if (m_drawBatching)
+        {
+            DrawBatch batch{*m_target};
+            m_container->drawWidgetContainer(m_target, sf::RenderStates::Default);
+        }
+        else
+            m_container->drawWidgetContainer(m_target, sf::RenderStates::Default);
 
         // Restore the old view
         m_target->setView(oldView);
 
-        // Reset clipping to its original state
-        if (clippingEnabled)
-            glScissor(scissor[0], scissor[1], scissor[2], scissor[3]);
+        // Disable clipping again
+        m_clippingStack.end();
+
+        if (m_renderStatisticsEnabled)
+            RenderStatistics::setActive(oldStatistics);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Gui::needsRedraw() const
+    {
+        return m_container->m_redrawNeeded || (timeUntilNextUpdate() == sf::Time::Zero);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::Time Gui::timeUntilNextUpdate() const
+    {
+        // Queued events are handled when the gui is updated
+        if (!m_queuedEvents.empty())
+            return sf::Time::Zero;
+
+        sf::Time time = m_container->timeUntilNextUpdate();
+
+        // A tool tip may have to be shown when the mouse stays at the same position long enough
+        if (m_tooltipPossible)
+            time = std::min(time, ToolTip::getTimeToDisplay() - m_tooltipTime);
+
+        // The widgets only know how much time had passed the last time the gui was drawn
+        const sf::Time timeSinceLastUpdate = m_clock.getElapsedTime();
+        if (time <= timeSinceLastUpdate)
+            return sf::Time::Zero;
         else
-            glDisable(GL_SCISSOR_TEST);
+            return time - timeSinceLastUpdate;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -424,6 +528,42 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Gui::setDrawBatching(bool batched)
+    {
+        m_drawBatching = batched;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Gui::isDrawBatchingEnabled() const
+    {
+        return m_drawBatching;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Gui::setRenderStatisticsEnabled(bool enabled)
+    {
+        m_renderStatisticsEnabled = enabled;
+        m_renderStatistics.reset();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Gui::isRenderStatisticsEnabled() const
+    {
+        return m_renderStatisticsEnabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const RenderStatistics& Gui::getRenderStatistics() const
+    {
+        return m_renderStatistics;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Gui::loadWidgetsFromFile(const std::string& filename)
     {
         m_container->loadWidgetsFromFile(filename);
@@ -461,6 +601,8 @@ namespace tgui
 
     void Gui::updateTime(const sf::Time& elapsedTime)
     {
+        processQueuedEvents();
+
         m_container->m_animationTimeElapsed = elapsedTime;
         m_container->update(elapsedTime);
 
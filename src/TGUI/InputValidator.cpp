@@ -0,0 +1,812 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include <TGUI/InputValidator.hpp>
+
+#include <algorithm>
+#include <limits>
+#include <map>
+#include <memory>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    namespace
+    {
+        const InputValidator::State InvalidState = std::numeric_limits<InputValidator::State>::max();
+        const sf::Uint32 MaxCodePoint = std::numeric_limits<sf::Uint32>::max();
+
+        // Limits that keep patterns with large repetition counts from using too much memory
+        const std::size_t MaxRepetitions = 1000;
+        const std::size_t MaxNfaStates = 10000;
+        const std::size_t MaxDfaStates = 1000;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Thrown while parsing when the pattern uses syntax that can't be turned into an automaton
+        struct UnsupportedPattern {};
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Sorted list of non-overlapping ranges of code points, both ends included
+        typedef std::vector<std::pair<sf::Uint32, sf::Uint32>> CharSet;
+
+        void normalizeCharSet(CharSet& set)
+        {
+            std::sort(set.begin(), set.end());
+
+            std::size_t last = 0;
+            for (std::size_t i = 1; i < set.size(); ++i)
+            {
+                if ((set[last].second != MaxCodePoint) && (set[i].first > set[last].second + 1))
+                    set[++last] = set[i];
+                else
+                    set[last].second = std::max(set[last].second, set[i].second);
+            }
+
+            if (!set.empty())
+                set.resize(last + 1);
+        }
+
+        CharSet negateCharSet(const CharSet& set)
+        {
+            CharSet result;
+            sf::Uint32 next = 0;
+            for (const auto& range : set)
+            {
+                if (range.first > next)
+                    result.push_back({next, range.first - 1});
+
+                if (range.second == MaxCodePoint)
+                    return result;
+
+                next = range.second + 1;
+            }
+
+            result.push_back({next, MaxCodePoint});
+            return result;
+        }
+
+        bool charSetContains(const CharSet& set, sf::Uint32 codePoint)
+        {
+            const auto it = std::upper_bound(set.begin(), set.end(), std::make_pair(codePoint, MaxCodePoint));
+            return (it != set.begin()) && (std::prev(it)->second >= codePoint);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        struct Node
+        {
+            enum class Type
+            {
+                Empty,
+                Chars,
+                Concat,
+                Alternate,
+                Repeat
+            };
+
+            Node(Type nodeType) : type{nodeType} {}
+
+            Type type;
+            CharSet chars;
+            std::vector<std::unique_ptr<Node>> children;
+            std::size_t minCount = 0;
+            std::size_t maxCount = 0; // Infinite when equal to MaxRepetitions + 1
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Recursive descent parser for the ECMAScript syntax, leaving out everything that needs backtracking
+        class Parser
+        {
+        public:
+
+            Parser(const std::string& pattern) :
+                m_pattern(pattern)
+            {
+            }
+
+            std::unique_ptr<Node> parse()
+            {
+                auto node = parseAlternation();
+                if (m_pos < m_pattern.size())
+                    throw UnsupportedPattern{};
+
+                return node;
+            }
+
+        private:
+
+            bool atEnd() const
+            {
+                return m_pos >= m_pattern.size();
+            }
+
+            char peek() const
+            {
+                return atEnd() ? '\0' : m_pattern[m_pos];
+            }
+
+            char next()
+            {
+                if (atEnd())
+                    throw UnsupportedPattern{};
+
+                const char c = m_pattern[m_pos++];
+
+                // Bytes of multi-byte characters can't be interpreted without knowing the encoding of the pattern
+                if (static_cast<unsigned char>(c) >= 0x80)
+                    throw UnsupportedPattern{};
+
+                return c;
+            }
+
+            static std::unique_ptr<Node> makeChars(CharSet chars)
+            {
+                auto node = std::make_unique<Node>(Node::Type::Chars);
+                node->chars = std::move(chars);
+                return node;
+            }
+
+            std::unique_ptr<Node> parseAlternation()
+            {
+                auto first = parseConcat();
+                if (peek() != '|')
+                    return first;
+
+                auto node = std::make_unique<Node>(Node::Type::Alternate);
+                node->children.push_back(std::move(first));
+                while (peek() == '|')
+                {
+                    ++m_pos;
+                    node->children.push_back(parseConcat());
+                }
+
+                return node;
+            }
+
+            std::unique_ptr<Node> parseConcat()
+            {
+                auto node = std::make_unique<Node>(Node::Type::Concat);
+                while (!atEnd() && (peek() != '|') && (peek() != ')'))
+                    node->children.push_back(parseRepeat());
+
+                return node;
+            }
+
+            std::unique_ptr<Node> parseRepeat()
+            {
+                auto atom = parseAtom();
+
+                std::size_t minCount;
+                std::size_t maxCount;
+                const char c = peek();
+                if (c == '*')
+                {
+                    minCount = 0;
+                    maxCount = MaxRepetitions + 1;
+                }
+                else if (c == '+')
+                {
+                    minCount = 1;
+                    maxCount = MaxRepetitions + 1;
+                }
+                else if (c == '?')
+                {
+                    minCount = 0;
+                    maxCount = 1;
+                }
+                else if (c == '{')
+                {
+                    ++m_pos;
+                    minCount = parseNumber();
+                    maxCount = minCount;
+                    if (peek() == ',')
+                    {
+                        ++m_pos;
+                        maxCount = (peek() == '}') ? MaxRepetitions + 1 : parseNumber();
+                    }
+
+                    if ((peek() != '}') || (minCount > maxCount))
+                        throw UnsupportedPattern{};
+                }
+                else
+                    return atom;
+
+                ++m_pos;
+
+                // Anchors can't be repeated
+                if (atom->type == Node::Type::Empty)
+                    throw UnsupportedPattern{};
+
+                // Whether the repetition is lazy doesn't matter when the whole text has to match
+                if (peek() == '?')
+                    ++m_pos;
+
+                auto node = std::make_unique<Node>(Node::Type::Repeat);
+                node->children.push_back(std::move(atom));
+                node->minCount = minCount;
+                node->maxCount = maxCount;
+                return node;
+            }
+
+            std::size_t parseNumber()
+            {
+                if ((peek() < '0') || (peek() > '9'))
+                    throw UnsupportedPattern{};
+
+                std::size_t number = 0;
+                while ((peek() >= '0') && (peek() <= '9'))
+                {
+                    number = number * 10 + static_cast<std::size_t>(next() - '0');
+                    if (number > MaxRepetitions)
+                        throw UnsupportedPattern{};
+                }
+
+                return number;
+            }
+
+            std::unique_ptr<Node> parseAtom()
+            {
+                const std::size_t pos = m_pos;
+                const char c = next();
+                switch (c)
+                {
+                    case '(':
+                    {
+                        if (peek() == '?')
+                        {
+                            // Only non-capturing groups are supported, lookahead needs backtracking
+                            ++m_pos;
+                            if (next() != ':')
+                                throw UnsupportedPattern{};
+                        }
+
+                        auto node = parseAlternation();
+                        if (next() != ')')
+                            throw UnsupportedPattern{};
+
+                        return node;
+                    }
+                    case '[':
+                        return makeChars(parseCharClass());
+                    case '.':
+                        return makeChars(negateCharSet({{'\n', '\n'}, {'\r', '\r'}, {0x2028, 0x2029}}));
+                    case '\\':
+                        return makeChars(parseEscape(false));
+                    case '^':
+                    case '$':
+                    {
+                        // The whole text is always matched, so anchors at the start and end of the pattern can be ignored
+                        if (((c == '^') && (pos == 0)) || ((c == '$') && (m_pos == m_pattern.size())))
+                            return std::make_unique<Node>(Node::Type::Empty);
+                        else
+                            throw UnsupportedPattern{};
+                    }
+                    case '*':
+                    case '+':
+                    case '?':
+                    case '{':
+                    case '}':
+                    case ']':
+                    case ')':
+                        throw UnsupportedPattern{};
+                    default:
+                        return makeChars({{static_cast<sf::Uint32>(c), static_cast<sf::Uint32>(c)}});
+                }
+            }
+
+            sf::Uint32 parseHex(unsigned int digits)
+            {
+                sf::Uint32 value = 0;
+                for (unsigned int i = 0; i < digits; ++i)
+                {
+                    const char c = next();
+                    if ((c >= '0') && (c <= '9'))
+                        value = value * 16 + static_cast<sf::Uint32>(c - '0');
+                    else if ((c >= 'a') && (c <= 'f'))
+                        value = value * 16 + static_cast<sf::Uint32>(c - 'a' + 10);
+                    else if ((c >= 'A') && (c <= 'F'))
+                        value = value * 16 + static_cast<sf::Uint32>(c - 'A' + 10);
+                    else
+                        throw UnsupportedPattern{};
+                }
+
+                return value;
+            }
+
+            CharSet parseEscape(bool insideCharClass)
+            {
+                const CharSet digits = {{'0', '9'}};
+                const CharSet wordChars = {{'0', '9'}, {'A', 'Z'}, {'_', '_'}, {'a', 'z'}};
+                const CharSet spaces = {{'\t', '\r'}, {' ', ' '}};
+
+                sf::Uint32 codePoint;
+                const char c = next();
+                switch (c)
+                {
+                    case 'd': return digits;
+                    case 'D': return negateCharSet(digits);
+                    case 'w': return wordChars;
+                    case 'W': return negateCharSet(wordChars);
+                    case 's': return spaces;
+                    case 'S': return negateCharSet(spaces);
+                    case 't': codePoint = '\t'; break;
+                    case 'n': codePoint = '\n'; break;
+                    case 'r': codePoint = '\r'; break;
+                    case 'v': codePoint = '\v'; break;
+                    case 'f': codePoint = '\f'; break;
+                    case 'x': codePoint = parseHex(2); break;
+                    case 'u': codePoint = parseHex(4); break;
+                    case '0':
+                    {
+                        // Octal escapes and backreferences are not supported
+                        if ((peek() >= '0') && (peek() <= '9'))
+                            throw UnsupportedPattern{};
+
+                        codePoint = 0;
+                        break;
+                    }
+                    case 'b':
+                    {
+                        // Word boundaries are not supported, but inside brackets it means backspace
+                        if (!insideCharClass)
+                            throw UnsupportedPattern{};
+
+                        codePoint = '\b';
+                        break;
+                    }
+                    default:
+                    {
+                        // Other letters and digits have a special meaning (e.g. backreferences) that isn't supported
+                        if (((c >= '0') && (c <= '9')) || ((c >= 'a') && (c <= 'z')) || ((c >= 'A') && (c <= 'Z')))
+                            throw UnsupportedPattern{};
+
+                        codePoint = static_cast<sf::Uint32>(c);
+                        break;
+                    }
+                }
+
+                return {{codePoint, codePoint}};
+            }
+
+            // Parses a character of a character class, returns false when it was a class escape like \d
+            bool parseCharClassAtom(CharSet& chars)
+            {
+                const char c = next();
+                if (c == '\\')
+                    chars = parseEscape(true);
+                else if ((c == '[') && ((peek() == ':') || (peek() == '.') || (peek() == '=')))
+                    throw UnsupportedPattern{}; // Posix character classes are not supported
+                else
+                    chars = {{static_cast<sf::Uint32>(c), static_cast<sf::Uint32>(c)}};
+
+                return (chars.size() == 1) && (chars[0].first == chars[0].second);
+            }
+
+            CharSet parseCharClass()
+            {
+                bool negated = false;
+                if (peek() == '^')
+                {
+                    negated = true;
+                    ++m_pos;
+                }
+
+                CharSet result;
+                while (peek() != ']')
+                {
+                    CharSet chars;
+                    const bool singleChar = parseCharClassAtom(chars);
+
+                    // Check whether this is a range
+                    if ((peek() == '-') && (m_pos + 1 < m_pattern.size()) && (m_pattern[m_pos + 1] != ']'))
+                    {
+                        ++m_pos;
+
+                        CharSet lastChars;
+                        if (!singleChar || !parseCharClassAtom(lastChars) || (lastChars[0].first < chars[0].first))
+                            throw UnsupportedPattern{};
+
+                        chars[0].second = lastChars[0].first;
+                    }
+
+                    result.insert(result.end(), chars.begin(), chars.end());
+                }
+
+                next(); // Skip the closing bracket
+
+                normalizeCharSet(result);
+                if (negated)
+                    return negateCharSet(result);
+                else
+                    return result;
+            }
+
+        private:
+
+            const std::string& m_pattern;
+            std::size_t m_pos = 0;
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Nondeterministic automaton, built from the parsed pattern with the thompson construction
+        class Nfa
+        {
+        public:
+
+            struct NfaState
+            {
+                std::vector<std::pair<std::size_t, std::size_t>> transitions; // Index in char sets and target state
+                std::vector<std::size_t> emptyTransitions;
+            };
+
+            std::vector<NfaState> states;
+            std::vector<CharSet> charSets;
+
+            // Returns the start and end states of the automaton for the node
+            std::pair<std::size_t, std::size_t> build(const Node& node)
+            {
+                const std::size_t start = addState();
+                const std::size_t end = addState();
+                switch (node.type)
+                {
+                    case Node::Type::Empty:
+                    {
+                        states[start].emptyTransitions.push_back(end);
+                        break;
+                    }
+                    case Node::Type::Chars:
+                    {
+                        charSets.push_back(node.chars);
+                        states[start].transitions.push_back({charSets.size() - 1, end});
+                        break;
+                    }
+                    case Node::Type::Concat:
+                    {
+                        std::size_t last = start;
+                        for (const auto& child : node.children)
+                        {
+                            const auto part = build(*child);
+                            states[last].emptyTransitions.push_back(part.first);
+                            last = part.second;
+                        }
+
+                        states[last].emptyTransitions.push_back(end);
+                        break;
+                    }
+                    case Node::Type::Alternate:
+                    {
+                        for (const auto& child : node.children)
+                        {
+                            const auto part = build(*child);
+                            states[start].emptyTransitions.push_back(part.first);
+                            states[part.second].emptyTransitions.push_back(end);
+                        }
+                        break;
+                    }
+                    case Node::Type::Repeat:
+                    {
+                        std::size_t last = start;
+                        for (std::size_t i = 0; i < node.minCount; ++i)
+                        {
+                            const auto part = build(*node.children[0]);
+                            states[last].emptyTransitions.push_back(part.first);
+                            last = part.second;
+                        }
+
+                        if (node.maxCount > MaxRepetitions)
+                        {
+                            // The part can be repeated as often as wanted
+                            const auto part = build(*node.children[0]);
+                            states[last].emptyTransitions.push_back(part.first);
+                            states[part.second].emptyTransitions.push_back(part.first);
+                            states[part.second].emptyTransitions.push_back(end);
+                        }
+                        else
+                        {
+                            // Every optional repetition can be skipped, which also skips the ones behind it
+                            for (std::size_t i = node.minCount; i < node.maxCount; ++i)
+                            {
+                                const auto part = build(*node.children[0]);
+                                states[last].emptyTransitions.push_back(part.first);
+                                states[last].emptyTransitions.push_back(end);
+                                last = part.second;
+                            }
+                        }
+
+                        states[last].emptyTransitions.push_back(end);
+                        break;
+                    }
+                }
+
+                return {start, end};
+            }
+
+            // Adds all states that can be reached without reading a character, the result is sorted
+            void addEmptyClosure(std::vector<std::size_t>& stateSet) const
+            {
+                std::vector<bool> visited(states.size(), false);
+                for (const auto state : stateSet)
+                    visited[state] = true;
+
+                std::vector<std::size_t> stack = stateSet;
+                while (!stack.empty())
+                {
+                    const std::size_t state = stack.back();
+                    stack.pop_back();
+
+                    for (const auto target : states[state].emptyTransitions)
+                    {
+                        if (!visited[target])
+                        {
+                            visited[target] = true;
+                            stateSet.push_back(target);
+                            stack.push_back(target);
+                        }
+                    }
+                }
+
+                std::sort(stateSet.begin(), stateSet.end());
+            }
+
+        private:
+
+            std::size_t addState()
+            {
+                if (states.size() >= MaxNfaStates)
+                    throw UnsupportedPattern{};
+
+                states.emplace_back();
+                return states.size() - 1;
+            }
+        };
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    InputValidator::InputValidator(const std::string& pattern) :
+        m_pattern{pattern}
+    {
+        // The patterns of the predefined validators are checked by hand
+        if (m_pattern == ".*")
+            m_type = Type::All;
+        else if (m_pattern == "[+-]?[0-9]*")
+            m_type = Type::Int;
+        else if (m_pattern == "[0-9]*")
+            m_type = Type::UInt;
+        else if (m_pattern == "[+-]?[0-9]*\\.?[0-9]*")
+            m_type = Type::Float;
+        else if (compileAutomaton())
+            m_type = Type::Automaton;
+        else
+        {
+            m_type = Type::Regex;
+            m_regex = m_pattern;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const std::string& InputValidator::getPattern() const
+    {
+        return m_pattern;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool InputValidator::isIncremental() const
+    {
+        return m_type != Type::Regex;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool InputValidator::match(const sf::String& text) const
+    {
+        if (m_type == Type::All)
+            return true;
+        else if (m_type == Type::Regex)
+            return std::regex_match(text.toAnsiString(), m_regex);
+
+        State state = getStartState();
+        for (const sf::Uint32 codePoint : text)
+        {
+            state = advance(state, codePoint);
+            if (state == InvalidState)
+                return false;
+        }
+
+        return isAccepting(state);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    InputValidator::State InputValidator::getStartState() const
+    {
+        return 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    InputValidator::State InputValidator::advance(State state, sf::Uint32 codePoint) const
+    {
+        if (state == InvalidState)
+            return InvalidState;
+
+        const bool isDigit = (codePoint >= '0') && (codePoint <= '9');
+        switch (m_type)
+        {
+            case Type::All:
+                return state;
+
+            case Type::Int: // State 0 is the start, in state 1 only digits can follow
+            {
+                if (isDigit || ((state == 0) && ((codePoint == '+') || (codePoint == '-'))))
+                    return 1;
+                else
+                    return InvalidState;
+            }
+
+            case Type::UInt:
+                return isDigit ? state : InvalidState;
+
+            case Type::Float: // State 0 is the start, state 1 is the integer part and state 2 is the fractional part
+            {
+                if (isDigit)
+                    return std::max<State>(state, 1);
+                else if ((state == 0) && ((codePoint == '+') || (codePoint == '-')))
+                    return 1;
+                else if ((state < 2) && (codePoint == '.'))
+                    return 2;
+                else
+                    return InvalidState;
+            }
+
+            case Type::Automaton:
+            {
+                const std::size_t range = static_cast<std::size_t>(std::upper_bound(m_rangeStarts.begin(), m_rangeStarts.end(), codePoint) - m_rangeStarts.begin()) - 1;
+                return m_transitions[state * m_rangeStarts.size() + range];
+            }
+
+            case Type::Regex:
+                break;
+        }
+
+        return InvalidState;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool InputValidator::isAccepting(State state) const
+    {
+        if (state == InvalidState)
+            return false;
+        else if (m_type == Type::Automaton)
+            return m_acceptingStates[state];
+        else
+            return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool InputValidator::compileAutomaton()
+    {
+        Nfa nfa;
+        std::pair<std::size_t, std::size_t> startAndEnd;
+        try
+        {
+            startAndEnd = nfa.build(*Parser{m_pattern}.parse());
+        }
+        catch (const UnsupportedPattern&)
+        {
+            return false;
+        }
+
+        // Split the code points into ranges in which no character set starts or ends, all code points in such a range lead to
+        // the same transitions
+        m_rangeStarts = {0};
+        for (const auto& charSet : nfa.charSets)
+        {
+            for (const auto& range : charSet)
+            {
+                m_rangeStarts.push_back(range.first);
+                if (range.second != MaxCodePoint)
+                    m_rangeStarts.push_back(range.second + 1);
+            }
+        }
+
+        std::sort(m_rangeStarts.begin(), m_rangeStarts.end());
+        m_rangeStarts.erase(std::unique(m_rangeStarts.begin(), m_rangeStarts.end()), m_rangeStarts.end());
+
+        std::vector<std::vector<bool>> charSetContainsRange(nfa.charSets.size(), std::vector<bool>(m_rangeStarts.size()));
+        for (std::size_t i = 0; i < nfa.charSets.size(); ++i)
+        {
+            for (std::size_t j = 0; j < m_rangeStarts.size(); ++j)
+                charSetContainsRange[i][j] = charSetContains(nfa.charSets[i], m_rangeStarts[j]);
+        }
+
+        // Every state of the deterministic automaton corresponds to a set of states of the nondeterministic one
+        std::vector<std::vector<std::size_t>> stateSets;
+        std::map<std::vector<std::size_t>, State> stateIndices;
+
+        std::vector<std::size_t> startSet = {startAndEnd.first};
+        nfa.addEmptyClosure(startSet);
+        stateIndices[startSet] = 0;
+        stateSets.push_back(std::move(startSet));
+
+        m_transitions.clear();
+        m_acceptingStates.clear();
+        for (std::size_t state = 0; state < stateSets.size(); ++state)
+        {
+            m_acceptingStates.push_back(std::binary_search(stateSets[state].begin(), stateSets[state].end(), startAndEnd.second));
+
+            for (std::size_t range = 0; range < m_rangeStarts.size(); ++range)
+            {
+                std::vector<std::size_t> targetSet;
+                for (const auto nfaState : stateSets[state])
+                {
+                    for (const auto& transition : nfa.states[nfaState].transitions)
+                    {
+                        if (charSetContainsRange[transition.first][range])
+                            targetSet.push_back(transition.second);
+                    }
+                }
+
+                if (targetSet.empty())
+                {
+                    m_transitions.push_back(InvalidState);
+                    continue;
+                }
+
+                std::sort(targetSet.begin(), targetSet.end());
+                targetSet.erase(std::unique(targetSet.begin(), targetSet.end()), targetSet.end());
+                nfa.addEmptyClosure(targetSet);
+
+                const auto it = stateIndices.find(targetSet);
+                if (it != stateIndices.end())
+                    m_transitions.push_back(it->second);
+                else
+                {
+                    if (stateSets.size() >= MaxDfaStates)
+                        return false;
+
+                    m_transitions.push_back(stateSets.size());
+                    stateIndices[targetSet] = stateSets.size();
+                    stateSets.push_back(std::move(targetSet));
+                }
+            }
+        }
+
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
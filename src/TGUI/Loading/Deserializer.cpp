@@ -25,6 +25,7 @@
 
 #include <TGUI/Loading/Deserializer.hpp>
 #include <TGUI/Loading/DataIO.hpp>
+#include <TGUI/FontManager.hpp>
 #include <TGUI/Renderers/WidgetRenderer.hpp>
 #include <TGUI/Global.hpp>
 #include <cassert>
@@ -77,8 +78,12 @@ namespace tgui
             if (value == "null" || value == "nullptr")
                 return Font{};
 
-            auto font = std::make_shared<sf::Font>();
-            font->loadFromFile(Deserializer::deserialize(ObjectConverter::Type::String, value).getString());
+            auto font = FontManager::getFont(Deserializer::deserialize(ObjectConverter::Type::String, value).getString());
+
+            // When the font couldn't be loaded, an empty font is returned just like sf::Font would be after a failed load
+            if (!font)
+                font = std::make_shared<sf::Font>();
+
             return Font(font);
         }
 
@@ -25,8 +25,11 @@
 
 #include <TGUI/Loading/Theme.hpp>
 #include <TGUI/Loading/Serializer.hpp>
+#include <TGUI/FontManager.hpp>
 #include <TGUI/Global.hpp>
 
+#include <algorithm>
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
@@ -174,6 +177,53 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Theme::preloadGlyphs(const std::vector<unsigned int>& textSizes, const sf::String& characters)
+    {
+        std::vector<Font> fonts;
+        const auto addFont = [&fonts](const Font& font)
+            {
+                if (font && std::none_of(fonts.begin(), fonts.end(), [&font](const Font& f){ return f.getFont() == font.getFont(); }))
+                    fonts.push_back(font);
+            };
+
+        // Widgets without a font in their renderer use the font of the gui
+        addFont(FontManager::getDefaultFont());
+
+        // Renderers that were already loaded or that were added manually
+        for (auto& pair : m_renderers)
+        {
+            auto it = pair.second->propertyValuePairs.find("font");
+            if ((it != pair.second->propertyValuePairs.end())
+             && ((it->second.getType() == ObjectConverter::Type::Font) || (it->second.getType() == ObjectConverter::Type::String)))
+            {
+                addFont(it->second.getFont());
+            }
+        }
+
+        // All sections of the theme, fonts are shared so the renderers that are loaded later will get the same fonts
+        if (!m_primary.empty())
+        {
+            for (const auto& section : m_themeLoader->getSecondaryParameters(m_primary))
+            {
+                const auto& properties = m_themeLoader->load(m_primary, section);
+                const auto it = properties.find("font");
+                if (it != properties.end())
+                    addFont(ObjectConverter(it->second).getFont());
+            }
+        }
+
+        for (const auto& font : fonts)
+        {
+            for (const unsigned int textSize : textSizes)
+                font.preloadGlyphs(characters, textSize);
+
+            if (std::none_of(m_preloadedFonts.begin(), m_preloadedFonts.end(), [&font](const Font& f){ return f.getFont() == font.getFont(); }))
+                m_preloadedFonts.push_back(font);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Theme::setThemeLoader(std::shared_ptr<BaseThemeLoader> themeLoader)
     {
         m_themeLoader = themeLoader;
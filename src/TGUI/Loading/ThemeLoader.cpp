@@ -26,6 +26,7 @@
 #include <TGUI/Loading/Deserializer.hpp>
 #include <TGUI/Loading/ThemeLoader.hpp>
 #include <TGUI/Loading/DataIO.hpp>
+#include <TGUI/TextureManager.hpp>
 #include <TGUI/Global.hpp>
 
 #include <cassert>
@@ -53,6 +54,7 @@ namespace tgui
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     std::map<std::string, std::map<std::string, std::map<sf::String, sf::String>>> DefaultThemeLoader::m_propertiesCache;
+    bool DefaultThemeLoader::m_textureAtlasEnabled = false;
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -86,6 +88,33 @@ namespace tgui
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+        void findTextureFilenames(std::vector<std::string>& filenames, const std::unique_ptr<DataIO::Node>& node)
+        {
+            for (const auto& pair : node->propertyValuePairs)
+            {
+                if ((pair.first.size() >= 7) && (toLower(pair.first.substr(0, 7)) == "texture"))
+                {
+                    const std::string value = pair.second->value;
+                    const auto openingQuotePos = value.find('"');
+                    if (openingQuotePos == std::string::npos)
+                        continue;
+
+                    // Find the closing quote, skipping escaped quotes
+                    auto closingQuotePos = value.find('"', openingQuotePos + 1);
+                    while ((closingQuotePos != std::string::npos) && (value[closingQuotePos-1] == '\\'))
+                        closingQuotePos = value.find('"', closingQuotePos + 1);
+
+                    if (closingQuotePos != std::string::npos)
+                        filenames.push_back(getResourcePath() + value.substr(openingQuotePos + 1, closingQuotePos - openingQuotePos - 1));
+                }
+            }
+
+            for (const auto& child : node->children)
+                findTextureFilenames(filenames, child);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
         void resolveReferences(std::map<std::string, std::reference_wrapper<const std::unique_ptr<DataIO::Node>>>& sections, const std::unique_ptr<DataIO::Node>& node)
         {
             for (const auto& pair : node->propertyValuePairs)
@@ -124,6 +153,13 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    std::vector<std::string> BaseThemeLoader::getSecondaryParameters(const std::string&)
+    {
+        return {};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void DefaultThemeLoader::flushCache(const std::string& filename)
     {
         if (filename != "")
@@ -140,6 +176,20 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void DefaultThemeLoader::setTextureAtlasEnabled(bool enabled)
+    {
+        m_textureAtlasEnabled = enabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool DefaultThemeLoader::isTextureAtlasEnabled()
+    {
+        return m_textureAtlasEnabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void DefaultThemeLoader::preload(const std::string& filename)
     {
         if (filename == "")
@@ -179,6 +229,14 @@ namespace tgui
             // Resolve references to sections
             resolveReferences(sections, root);
 
+            // Pack all images used by the theme together
+            if (m_textureAtlasEnabled)
+            {
+                std::vector<std::string> textureFilenames;
+                findTextureFilenames(textureFilenames, root);
+                TextureManager::createAtlas(textureFilenames);
+            }
+
             // Cache all propery value pairs
             for (const auto& section : sections)
             {
@@ -217,6 +275,23 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    std::vector<std::string> DefaultThemeLoader::getSecondaryParameters(const std::string& filename)
+    {
+        preload(filename);
+
+        std::vector<std::string> sections;
+        const auto cacheIt = m_propertiesCache.find(filename);
+        if (cacheIt != m_propertiesCache.end())
+        {
+            for (const auto& section : cacheIt->second)
+                sections.push_back(section.first);
+        }
+
+        return sections;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void DefaultThemeLoader::readFile(const std::string& filename, std::stringstream& contents) const
     {
         std::string fullFilename = getResourcePath() + filename;
@@ -54,6 +54,8 @@
 #include <TGUI/Widgets/TextBox.hpp>
 #include <TGUI/Widgets/VerticalLayout.hpp>
 
+#include <set>
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
@@ -1072,6 +1074,18 @@ namespace tgui
         }
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void findTextSizesInNode(const std::unique_ptr<DataIO::Node>& node, std::set<unsigned int>& textSizes)
+        {
+            const auto it = node->propertyValuePairs.find("textsize");
+            if ((it != node->propertyValuePairs.end()) && (tgui::stoi(it->second->value) > 0))
+                textSizes.insert(static_cast<unsigned int>(tgui::stoi(it->second->value)));
+
+            for (const auto& child : node->children)
+                findTextSizesInNode(child, textSizes);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1140,6 +1154,15 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    std::vector<unsigned int> WidgetLoader::findTextSizes(std::stringstream& stream)
+    {
+        std::set<unsigned int> textSizes;
+        findTextSizesInNode(DataIO::parse(stream), textSizes);
+        return {textSizes.begin(), textSizes.end()};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void WidgetLoader::setLoadFunction(const std::string& type, const LoadFunction& loadFunction)
     {
         m_loadFunctions[toLower(type)] = loadFunction;
@@ -0,0 +1,209 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include <TGUI/MappedFile.hpp>
+
+#include <fstream>
+
+#if defined(SFML_SYSTEM_WINDOWS)
+    #include <windows.h>
+#elif defined(SFML_SYSTEM_LINUX) || defined(SFML_SYSTEM_MACOS) || defined(SFML_SYSTEM_FREEBSD)
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <fcntl.h>
+    #include <unistd.h>
+    #define TGUI_USE_MMAP
+#endif
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    MappedFile::~MappedFile()
+    {
+        close();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool MappedFile::open(const std::string& filename, bool mapIntoMemory)
+    {
+        close();
+
+        if (mapIntoMemory && map(filename))
+            return true;
+
+        return read(filename);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void MappedFile::close()
+    {
+    #if defined(SFML_SYSTEM_WINDOWS)
+        if (m_data && !m_buffer)
+            UnmapViewOfFile(m_data);
+        if (m_mappingHandle)
+            CloseHandle(m_mappingHandle);
+        if (m_fileHandle)
+            CloseHandle(m_fileHandle);
+    #elif defined(TGUI_USE_MMAP)
+        if (m_data && !m_buffer)
+            munmap(const_cast<char*>(m_data), m_size);
+    #endif
+
+        m_fileHandle = nullptr;
+        m_mappingHandle = nullptr;
+        m_buffer = nullptr;
+        m_data = nullptr;
+        m_size = 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool MappedFile::isMapped() const
+    {
+        return m_data && !m_buffer;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const char* MappedFile::getData() const
+    {
+        return m_data;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t MappedFile::getSize() const
+    {
+        return m_size;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool MappedFile::map(const std::string& filename)
+    {
+    #if defined(SFML_SYSTEM_WINDOWS)
+        HANDLE file = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE)
+            return false;
+
+        m_fileHandle = file;
+
+        LARGE_INTEGER fileSize;
+        if (!GetFileSizeEx(file, &fileSize) || (fileSize.QuadPart < 0))
+        {
+            close();
+            return false;
+        }
+
+        // An empty file can't be mapped
+        if (fileSize.QuadPart == 0)
+            return true;
+
+        m_mappingHandle = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (!m_mappingHandle)
+        {
+            close();
+            return false;
+        }
+
+        m_data = static_cast<const char*>(MapViewOfFile(m_mappingHandle, FILE_MAP_READ, 0, 0, 0));
+        if (!m_data)
+        {
+            close();
+            return false;
+        }
+
+        m_size = static_cast<std::size_t>(fileSize.QuadPart);
+        return true;
+    #elif defined(TGUI_USE_MMAP)
+        const int file = ::open(filename.c_str(), O_RDONLY);
+        if (file < 0)
+            return false;
+
+        struct stat fileInfo;
+        if ((fstat(file, &fileInfo) != 0) || (fileInfo.st_size < 0))
+        {
+            ::close(file);
+            return false;
+        }
+
+        // An empty file can't be mapped
+        if (fileInfo.st_size == 0)
+        {
+            ::close(file);
+            return true;
+        }
+
+        // The mapping remains valid after the file is closed
+        void* data = mmap(nullptr, static_cast<std::size_t>(fileInfo.st_size), PROT_READ, MAP_PRIVATE, file, 0);
+        ::close(file);
+        if (data == MAP_FAILED)
+            return false;
+
+        m_data = static_cast<const char*>(data);
+        m_size = static_cast<std::size_t>(fileInfo.st_size);
+        return true;
+    #else
+        (void)filename;
+        return false;
+    #endif
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool MappedFile::read(const std::string& filename)
+    {
+        std::ifstream file{filename, std::ios::binary | std::ios::ate};
+        if (!file.is_open())
+            return false;
+
+        const std::streamoff size = file.tellg();
+        if (size < 0)
+            return false;
+
+        // Just like when mapping the file, there is no data for an empty file
+        if (size == 0)
+            return true;
+
+        m_buffer = std::make_unique<char[]>(static_cast<std::size_t>(size));
+        file.seekg(0);
+        if (!file.read(m_buffer.get(), size))
+        {
+            m_buffer = nullptr;
+            return false;
+        }
+
+        m_data = m_buffer.get();
+        m_size = static_cast<std::size_t>(size);
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
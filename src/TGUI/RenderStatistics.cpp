@@ -0,0 +1,81 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <TGUI/RenderStatistics.hpp>
+#include <TGUI/Widget.hpp>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    RenderStatistics* RenderStatistics::m_activeStatistics = nullptr;
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void RenderStatistics::reset()
+    {
+        drawCalls = 0;
+        vertices = 0;
+        textureSwitches = 0;
+        scissorChanges = 0;
+        widgetsVisited = 0;
+        widgetsCulled = 0;
+        widgetTimes.clear();
+        m_lastTexture = nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    RenderStatistics* RenderStatistics::getActive()
+    {
+        return m_activeStatistics;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void RenderStatistics::setActive(RenderStatistics* statistics)
+    {
+        m_activeStatistics = statistics;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void RenderStatistics::addDrawCall(std::size_t vertexCount, const sf::Texture* texture)
+    {
+        ++drawCalls;
+        vertices += vertexCount;
+
+        // The first draw call of the frame also binds its texture
+        if ((texture != m_lastTexture) || (drawCalls == 1))
+            ++textureSwitches;
+
+        m_lastTexture = texture;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -24,6 +24,7 @@
 
 
 #include <TGUI/Sprite.hpp>
+#include <TGUI/DrawBatch.hpp>
 #include <TGUI/Color.hpp>
 #include <TGUI/Clipping.hpp>
 
@@ -145,74 +146,74 @@ namespace tgui
         // Find out on which pixel the mouse is standing
         sf::Vector2u pixel;
         sf::IntRect middleRect = m_texture.getMiddleRect();
-        const sf::Texture& texture = m_texture.getData()->texture;
+        const sf::Vector2u textureSize{m_texture.getImageSize()};
         switch (m_scalingType)
         {
             case ScalingType::Normal:
             {
-                pixel.x = static_cast<unsigned int>(pos.x / m_size.x * texture.getSize().x);
-                pixel.y = static_cast<unsigned int>(pos.y / m_size.y * texture.getSize().y);
+                pixel.x = static_cast<unsigned int>(pos.x / m_size.x * textureSize.x);
+                pixel.y = static_cast<unsigned int>(pos.y / m_size.y * textureSize.y);
                 break;
             }
             case ScalingType::Horizontal:
             {
-                if (pos.x >= m_size.x - (texture.getSize().x - middleRect.left - middleRect.width) * (m_size.y / texture.getSize().y))
+                if (pos.x >= m_size.x - (textureSize.x - middleRect.left - middleRect.width) * (m_size.y / textureSize.y))
                 {
-                    float xDiff = (pos.x - (m_size.x - (texture.getSize().x - middleRect.left - middleRect.width) * (m_size.y / texture.getSize().y)));
-                    pixel.x = static_cast<unsigned int>(middleRect.left + middleRect.width + (xDiff / m_size.y * texture.getSize().y));
+                    float xDiff = (pos.x - (m_size.x - (textureSize.x - middleRect.left - middleRect.width) * (m_size.y / textureSize.y)));
+                    pixel.x = static_cast<unsigned int>(middleRect.left + middleRect.width + (xDiff / m_size.y * textureSize.y));
                 }
-                else if (pos.x >= middleRect.left * (m_size.y / texture.getSize().y))
+                else if (pos.x >= middleRect.left * (m_size.y / textureSize.y))
                 {
-                    float xDiff = pos.x - (middleRect.left * (m_size.y / texture.getSize().y));
-                    pixel.x = static_cast<unsigned int>(middleRect.left + (xDiff / (m_size.x - ((texture.getSize().x - middleRect.width) * (m_size.y / texture.getSize().y))) * middleRect.width));
+                    float xDiff = pos.x - (middleRect.left * (m_size.y / textureSize.y));
+                    pixel.x = static_cast<unsigned int>(middleRect.left + (xDiff / (m_size.x - ((textureSize.x - middleRect.width) * (m_size.y / textureSize.y))) * middleRect.width));
                 }
                 else // Mouse on the left part
                 {
-                    pixel.x = static_cast<unsigned int>(pos.x / m_size.y * texture.getSize().y);
+                    pixel.x = static_cast<unsigned int>(pos.x / m_size.y * textureSize.y);
                 }
 
-                pixel.y = static_cast<unsigned int>(pos.y / m_size.y * texture.getSize().y);
+                pixel.y = static_cast<unsigned int>(pos.y / m_size.y * textureSize.y);
                 break;
             }
             case ScalingType::Vertical:
             {
-                if (pos.y >= m_size.y - (texture.getSize().y - middleRect.top - middleRect.height) * (m_size.x / texture.getSize().x))
+                if (pos.y >= m_size.y - (textureSize.y - middleRect.top - middleRect.height) * (m_size.x / textureSize.x))
                 {
-                    float yDiff = (pos.y - (m_size.y - (texture.getSize().y - middleRect.top - middleRect.height) * (m_size.x / texture.getSize().x)));
-                    pixel.y = static_cast<unsigned int>(middleRect.top + middleRect.height + (yDiff / m_size.x * texture.getSize().x));
+                    float yDiff = (pos.y - (m_size.y - (textureSize.y - middleRect.top - middleRect.height) * (m_size.x / textureSize.x)));
+                    pixel.y = static_cast<unsigned int>(middleRect.top + middleRect.height + (yDiff / m_size.x * textureSize.x));
                 }
-                else if (pos.y >= middleRect.top * (m_size.x / texture.getSize().x))
+                else if (pos.y >= middleRect.top * (m_size.x / textureSize.x))
                 {
-                    float yDiff = pos.y - (middleRect.top * (m_size.x / texture.getSize().x));
-                    pixel.y = static_cast<unsigned int>(middleRect.top + (yDiff / (m_size.y - ((texture.getSize().y - middleRect.height) * (m_size.x / texture.getSize().x))) * middleRect.height));
+                    float yDiff = pos.y - (middleRect.top * (m_size.x / textureSize.x));
+                    pixel.y = static_cast<unsigned int>(middleRect.top + (yDiff / (m_size.y - ((textureSize.y - middleRect.height) * (m_size.x / textureSize.x))) * middleRect.height));
                 }
                 else // Mouse on the top part
                 {
-                    pixel.y = static_cast<unsigned int>(pos.y / m_size.x * texture.getSize().x);
+                    pixel.y = static_cast<unsigned int>(pos.y / m_size.x * textureSize.x);
                 }
 
-                pixel.x = static_cast<unsigned int>(pos.x / m_size.x * texture.getSize().x);
+                pixel.x = static_cast<unsigned int>(pos.x / m_size.x * textureSize.x);
                 break;
             }
             case ScalingType::NineSlice:
             {
                 if (pos.x < middleRect.left)
                     pixel.x = static_cast<unsigned int>(pos.x);
-                else if (pos.x >= m_size.x - (texture.getSize().x - middleRect.width - middleRect.left))
-                    pixel.x = static_cast<unsigned int>(pos.x - m_size.x + texture.getSize().x);
+                else if (pos.x >= m_size.x - (textureSize.x - middleRect.width - middleRect.left))
+                    pixel.x = static_cast<unsigned int>(pos.x - m_size.x + textureSize.x);
                 else
                 {
-                    float xDiff = (pos.x - middleRect.left) / (m_size.x - (texture.getSize().x - middleRect.width)) * middleRect.width;
+                    float xDiff = (pos.x - middleRect.left) / (m_size.x - (textureSize.x - middleRect.width)) * middleRect.width;
                     pixel.x = static_cast<unsigned int>(middleRect.left + xDiff);
                 }
 
                 if (pos.y < middleRect.top)
                     pixel.y = static_cast<unsigned int>(pos.y);
-                else if (pos.y >= m_size.y - (texture.getSize().y - middleRect.height - middleRect.top))
-                    pixel.y = static_cast<unsigned int>(pos.y - m_size.y + texture.getSize().y);
+                else if (pos.y >= m_size.y - (textureSize.y - middleRect.height - middleRect.top))
+                    pixel.y = static_cast<unsigned int>(pos.y - m_size.y + textureSize.y);
                 else
                 {
-                    float yDiff = (pos.y - middleRect.top) / (m_size.y - (texture.getSize().y - middleRect.height)) * middleRect.height;
+                    float yDiff = (pos.y - middleRect.top) / (m_size.y - (textureSize.y - middleRect.height)) * middleRect.height;
                     pixel.y = static_cast<unsigned int>(middleRect.top + yDiff);
                 }
 
@@ -363,6 +364,14 @@ namespace tgui
             m_vertices[21] = {{m_size.x, m_size.y}, m_vertexColor, {textureSize.x, textureSize.y}};
             break;
         };
+
+        // The image may only be a small part of a bigger texture
+        m_textureOffset = {m_texture.getData()->textureRect.left, m_texture.getData()->textureRect.top};
+        if ((m_textureOffset.x != 0) || (m_textureOffset.y != 0))
+        {
+            for (auto& vertex : m_vertices)
+                vertex.texCoords += sf::Vector2f{m_textureOffset};
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -387,8 +396,18 @@ namespace tgui
             if (m_visibleRect != sf::FloatRect{0, 0, 0, 0})
                 clipping = std::make_unique<Clipping>(target, states, sf::Vector2f{m_visibleRect.left, m_visibleRect.top}, sf::Vector2f{m_visibleRect.width, m_visibleRect.height});
 
-            states.texture = &m_texture.getData()->texture;
-            target.draw(m_vertices.data(), m_vertices.size(), sf::PrimitiveType::TrianglesStrip, states);
+            // Enabling smoothing on a texture that was shared moves the image to a texture of its own
+            const sf::Vector2i textureOffset{m_texture.getData()->textureRect.left, m_texture.getData()->textureRect.top};
+            if (textureOffset != m_textureOffset)
+            {
+                for (auto& vertex : m_vertices)
+                    vertex.texCoords += sf::Vector2f{textureOffset - m_textureOffset};
+
+                m_textureOffset = textureOffset;
+            }
+
+            states.texture = m_texture.getData()->texture.get();
+            DrawBatch::draw(target, m_vertices.data(), m_vertices.size(), sf::PrimitiveType::TrianglesStrip, states);
         }
     }
 
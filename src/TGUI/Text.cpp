@@ -25,11 +25,61 @@
 
 #include <TGUI/Text.hpp>
 #include <TGUI/Global.hpp>
+#include <TGUI/DrawBatch.hpp>
+#include <TGUI/FontMetrics.hpp>
 #include <SFML/Graphics/RenderTarget.hpp>
+#include <algorithm>
 #include <cmath>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+namespace
+{
+    // Adds an underline or strike through line, in the same way as sf::Text does it
+    void addLine(std::vector<sf::Vertex>& vertices, float lineLength, float lineTop, sf::Color color, float offset, float thickness)
+    {
+        const float top = std::floor(lineTop + offset - (thickness / 2) + 0.5f);
+        const float bottom = top + std::floor(thickness + 0.5f);
+
+        vertices.emplace_back(sf::Vector2f{0, top}, color, sf::Vector2f{1, 1});
+        vertices.emplace_back(sf::Vector2f{lineLength, top}, color, sf::Vector2f{1, 1});
+        vertices.emplace_back(sf::Vector2f{0, bottom}, color, sf::Vector2f{1, 1});
+        vertices.emplace_back(sf::Vector2f{0, bottom}, color, sf::Vector2f{1, 1});
+        vertices.emplace_back(sf::Vector2f{lineLength, top}, color, sf::Vector2f{1, 1});
+        vertices.emplace_back(sf::Vector2f{lineLength, bottom}, color, sf::Vector2f{1, 1});
+    }
+
+    // Adds the two triangles of a character, in the same way as sf::Text does it
+    void addGlyphQuad(std::vector<sf::Vertex>& vertices, sf::Vector2f position, sf::Color color, const sf::Glyph& glyph, float italicShear)
+    {
+    #if SFML_VERSION_MAJOR > 2 || (SFML_VERSION_MAJOR == 2 && SFML_VERSION_MINOR >= 5)
+        // Since SFML 2.5 the padding around the glyph in the texture is no longer part of the glyph rectangles
+        const float padding = 1;
+    #else
+        const float padding = 0;
+    #endif
+
+        const float left   = glyph.bounds.left - padding;
+        const float top    = glyph.bounds.top - padding;
+        const float right  = glyph.bounds.left + glyph.bounds.width + padding;
+        const float bottom = glyph.bounds.top + glyph.bounds.height + padding;
+
+        const float u1 = static_cast<float>(glyph.textureRect.left) - padding;
+        const float v1 = static_cast<float>(glyph.textureRect.top) - padding;
+        const float u2 = static_cast<float>(glyph.textureRect.left + glyph.textureRect.width) + padding;
+        const float v2 = static_cast<float>(glyph.textureRect.top + glyph.textureRect.height) + padding;
+
+        vertices.emplace_back(sf::Vector2f{position.x + left - italicShear * top, position.y + top}, color, sf::Vector2f{u1, v1});
+        vertices.emplace_back(sf::Vector2f{position.x + right - italicShear * top, position.y + top}, color, sf::Vector2f{u2, v1});
+        vertices.emplace_back(sf::Vector2f{position.x + left - italicShear * bottom, position.y + bottom}, color, sf::Vector2f{u1, v2});
+        vertices.emplace_back(sf::Vector2f{position.x + left - italicShear * bottom, position.y + bottom}, color, sf::Vector2f{u1, v2});
+        vertices.emplace_back(sf::Vector2f{position.x + right - italicShear * top, position.y + top}, color, sf::Vector2f{u2, v1});
+        vertices.emplace_back(sf::Vector2f{position.x + right - italicShear * bottom, position.y + bottom}, color, sf::Vector2f{u2, v2});
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
 namespace tgui
 {
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -43,7 +93,11 @@ namespace tgui
 
     void Text::setString(const sf::String& string)
     {
+        if (string == m_text.getString())
+            return;
+
         m_text.setString(string);
+        m_geometryNeedUpdate = true;
         recalculateSize();
     }
 
@@ -58,7 +112,11 @@ namespace tgui
 
     void Text::setCharacterSize(unsigned int size)
     {
+        if (size == m_text.getCharacterSize())
+            return;
+
         m_text.setCharacterSize(size);
+        m_geometryNeedUpdate = true;
         recalculateSize();
     }
 
@@ -74,12 +132,7 @@ namespace tgui
     void Text::setColor(Color color)
     {
         m_color = color;
-
-    #if SFML_VERSION_MAJOR > 2 || (SFML_VERSION_MAJOR == 2 && SFML_VERSION_MINOR >= 4)
-        m_text.setFillColor(Color::calcColorOpacity(color, m_opacity));
-    #else
-        m_text.setColor(Color::calcColorOpacity(color, m_opacity));
-    #endif
+        m_colorNeedUpdate = true;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -94,12 +147,7 @@ namespace tgui
     void Text::setOpacity(float opacity)
     {
         m_opacity = opacity;
-
-    #if SFML_VERSION_MAJOR > 2 || (SFML_VERSION_MAJOR == 2 && SFML_VERSION_MINOR >= 4)
-        m_text.setFillColor(Color::calcColorOpacity(m_color, opacity));
-    #else
-        m_text.setColor(Color::calcColorOpacity(m_color, opacity));
-    #endif
+        m_colorNeedUpdate = true;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -113,10 +161,14 @@ namespace tgui
 
     void Text::setFont(Font font)
     {
+        if ((font.getFont() == m_font.getFont()) && (font.getFont() != nullptr))
+            return;
+
         m_font = font;
         if (font)
             m_text.setFont(*font.getFont());
 
+        m_geometryNeedUpdate = true;
         recalculateSize();
     }
 
@@ -134,6 +186,7 @@ namespace tgui
         if (style != m_text.getStyle())
         {
             m_text.setStyle(style);
+            m_geometryNeedUpdate = true;
             recalculateSize();
         }
     }
@@ -164,7 +217,144 @@ namespace tgui
                                          matrix[1], matrix[5], std::floor(matrix[13]),
                                          matrix[3], matrix[7], matrix[15]};
 
-        target.draw(m_text, states);
+        if (m_geometryNeedUpdate)
+            updateGeometry();
+        else if (m_colorNeedUpdate)
+            updateVertexColors();
+
+        if (m_vertices.empty())
+            return;
+
+        states.texture = &m_font.getFont()->getTexture(m_text.getCharacterSize());
+
+    #if SFML_VERSION_MAJOR > 2 || (SFML_VERSION_MAJOR == 2 && SFML_VERSION_MINOR >= 5)
+        // Outside a batch the vertices are kept in video memory so that they don't have to be send again every frame
+        if (!DrawBatch::isBatching(target) && sf::VertexBuffer::isAvailable())
+        {
+            if (!m_vertexBuffer.buffer)
+                m_vertexBuffer.buffer = std::make_unique<sf::VertexBuffer>(sf::PrimitiveType::Triangles, sf::VertexBuffer::Static);
+
+            if (m_vertexBuffer.needsUpdate)
+            {
+                if (m_vertexBuffer.buffer->getVertexCount() != m_vertices.size())
+                    m_vertexBuffer.buffer->create(m_vertices.size());
+
+                m_vertexBuffer.buffer->update(m_vertices.data());
+                m_vertexBuffer.needsUpdate = false;
+            }
+
+            DrawBatch::draw(target, *m_vertexBuffer.buffer, states);
+            return;
+        }
+    #endif
+
+        DrawBatch::draw(target, m_vertices.data(), m_vertices.size(), sf::PrimitiveType::Triangles, states);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Text::updateGeometry() const
+    {
+        m_geometryNeedUpdate = false;
+        m_colorNeedUpdate = false;
+    #if SFML_VERSION_MAJOR > 2 || (SFML_VERSION_MAJOR == 2 && SFML_VERSION_MINOR >= 5)
+        m_vertexBuffer.needsUpdate = true;
+    #endif
+
+        m_vertices.clear();
+
+        const std::shared_ptr<sf::Font> font = m_font;
+        const sf::String& string = m_text.getString();
+        if ((font == nullptr) || string.isEmpty())
+            return;
+
+        const sf::Color color = Color::calcColorOpacity(m_color, m_opacity);
+        const unsigned int characterSize = m_text.getCharacterSize();
+        const TextStyle style = m_text.getStyle();
+        const bool bold = (style & sf::Text::Bold) != 0;
+        const bool underlined = (style & sf::Text::Underlined) != 0;
+        const float italicShear = (style & sf::Text::Italic) ? 0.209f : 0.f; // 12 degrees, the same as sf::Text uses
+        const float underlineOffset = font->getUnderlinePosition(characterSize);
+        const float underlineThickness = font->getUnderlineThickness(characterSize);
+    #if SFML_VERSION_MAJOR > 2 || (SFML_VERSION_MAJOR == 2 && SFML_VERSION_MINOR >= 4)
+        const bool strikeThrough = (style & sf::Text::StrikeThrough) != 0;
+        const sf::FloatRect xBounds = font->getGlyph('x', characterSize, bold).bounds;
+        const float strikeThroughOffset = xBounds.top + xBounds.height / 2.f;
+    #else
+        const bool strikeThrough = false;
+        const float strikeThroughOffset = 0;
+    #endif
+
+        const FontMetrics& metrics = FontMetrics::get(font, characterSize, bold);
+        const float whitespaceWidth = metrics.getAdvance(' ');
+        const float lineSpacing = metrics.getLineSpacing();
+
+        m_vertices.reserve(6 * string.getSize());
+
+        float x = 0;
+        float y = static_cast<float>(characterSize);
+        sf::Uint32 prevChar = 0;
+        for (std::size_t i = 0; i < string.getSize(); ++i)
+        {
+            const sf::Uint32 curChar = string[i];
+            if (curChar == '\r')
+                continue;
+
+            x += metrics.getKerning(prevChar, curChar);
+
+            // Finish the lines below or through the text when a new line starts
+            if ((curChar == '\n') && (prevChar != '\n'))
+            {
+                if (underlined)
+                    addLine(m_vertices, x, y, color, underlineOffset, underlineThickness);
+                if (strikeThrough)
+                    addLine(m_vertices, x, y, color, strikeThroughOffset, underlineThickness);
+            }
+
+            prevChar = curChar;
+
+            if (curChar == ' ')
+                x += whitespaceWidth;
+            else if (curChar == '\t')
+                x += whitespaceWidth * 4;
+            else if (curChar == '\n')
+            {
+                y += lineSpacing;
+                x = 0;
+            }
+            else
+            {
+                const sf::Glyph& glyph = font->getGlyph(curChar, characterSize, bold);
+                addGlyphQuad(m_vertices, {x, y}, color, glyph, italicShear);
+                x += glyph.advance;
+            }
+        }
+
+        if (x > 0)
+        {
+            if (underlined)
+                addLine(m_vertices, x, y, color, underlineOffset, underlineThickness);
+            if (strikeThrough)
+                addLine(m_vertices, x, y, color, strikeThroughOffset, underlineThickness);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Text::updateVertexColors() const
+    {
+        m_colorNeedUpdate = false;
+
+        const sf::Color color = Color::calcColorOpacity(m_color, m_opacity);
+        if (!m_vertices.empty() && (m_vertices.front().color == color))
+            return;
+
+        for (auto& vertex : m_vertices)
+            vertex.color = color;
+
+    #if SFML_VERSION_MAJOR > 2 || (SFML_VERSION_MAJOR == 2 && SFML_VERSION_MINOR >= 5)
+        m_vertexBuffer.needsUpdate = true;
+    #endif
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -184,10 +374,10 @@ namespace tgui
         sf::Uint32 prevChar = 0;
         const sf::String& string = m_text.getString();
         const bool bold = (m_text.getStyle() & sf::Text::Bold) != 0;
-        const unsigned int textSize = m_text.getCharacterSize();
+        const FontMetrics& metrics = FontMetrics::get(font, m_text.getCharacterSize(), bold);
         for (std::size_t i = 0; i < string.getSize(); ++i)
         {
-            const float kerning = static_cast<float>(font->getKerning(prevChar, string[i], textSize));
+            const float kerning = metrics.getKerning(prevChar, string[i]);
             if (string[i] == '\n')
             {
                 maxWidth = std::max(maxWidth, width);
@@ -195,15 +385,14 @@ namespace tgui
                 lines++;
             }
             else if (string[i] == '\t')
-                width += (static_cast<float>(font->getGlyph(' ', textSize, bold).advance) * 4) + kerning;
+                width += (metrics.getAdvance(' ') * 4) + kerning;
             else
-                width += static_cast<float>(font->getGlyph(string[i], textSize, bold).advance) + kerning;
+                width += metrics.getAdvance(string[i]) + kerning;
 
             prevChar = string[i];
         }
 
-        const float extraVerticalSpace = Text::calculateExtraVerticalSpace(m_font, m_text.getCharacterSize(), m_text.getStyle());
-        m_size = {std::max(maxWidth, width), lines * font->getLineSpacing(m_text.getCharacterSize()) + extraVerticalSpace};
+        m_size = {std::max(maxWidth, width), lines * metrics.getLineSpacing() + metrics.getExtraVerticalSpace()};
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -222,16 +411,20 @@ namespace tgui
             textSizes[i] = i + 1;
 
         const auto high = std::lower_bound(textSizes.begin(), textSizes.end(), height,
-                                           [&](unsigned int charSize, float h) { return font->getLineSpacing(charSize) + Text::calculateExtraVerticalSpace(font, charSize) < h; });
+                                           [&](unsigned int charSize, float h)
+                                           {
+                                               const FontMetrics& metrics = FontMetrics::get(font, charSize, false);
+                                               return metrics.getLineSpacing() + metrics.getExtraVerticalSpace() < h;
+                                           });
         if (high == textSizes.end())
             return static_cast<unsigned int>(height);
 
-        const float highLineSpacing = font->getLineSpacing(*high);
+        const float highLineSpacing = FontMetrics::get(font, *high, false).getLineSpacing();
         if (highLineSpacing == height)
             return *high;
 
         const auto low = high - 1;
-        const float lowLineSpacing = font->getLineSpacing(*low);
+        const float lowLineSpacing = FontMetrics::get(font, *low, false).getLineSpacing();
 
         if (fit < 0)
             return *low;
@@ -251,51 +444,59 @@ namespace tgui
     float Text::calculateExtraVerticalSpace(Font font, unsigned int characterSize, TextStyle style)
     {
         const bool bold = (style & sf::Text::Bold) != 0;
-
-        // Calculate the height of the first line (char size = everything above baseline, height + top = part below baseline)
-        const float lineHeight = characterSize
-                                 + font.getFont()->getGlyph('g', characterSize, bold).bounds.height
-                                 + font.getFont()->getGlyph('g', characterSize, bold).bounds.top;
-
-        // Get the line spacing sfml returns
-        const float lineSpacing = font.getFont()->getLineSpacing(characterSize);
-
-        // Calculate the offset of the text
-        return lineHeight - lineSpacing;
+        return FontMetrics::get(font, characterSize, bold).getExtraVerticalSpace();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    sf::String Text::wordWrap(float maxWidth, const sf::String& text, Font font, unsigned int textSize, bool bold, bool dropLeadingSpace)
+    std::vector<std::size_t> Text::findLineBreaks(float maxWidth, const sf::String& text, Font font, unsigned int textSize, bool bold, bool dropLeadingSpace)
     {
-        if (font == nullptr)
-            return "";
+        std::vector<std::size_t> lineBreaks;
+
+        // Without a font the text can only be split on its newlines
+        const FontMetrics* metrics = nullptr;
+        if (font != nullptr)
+            metrics = &FontMetrics::get(font, textSize, bold);
+        else
+            maxWidth = 0;
+
+        const sf::Uint32* const chars = text.getData();
+        const std::size_t length = text.getSize();
 
-        sf::String result;
         std::size_t index = 0;
-        while (index < text.getSize())
+        while (index < length)
         {
             const std::size_t oldIndex = index;
 
+            if (maxWidth == 0)
+            {
+                // There is no limit on the width, so the line simply ends after the next newline
+                index = static_cast<std::size_t>(std::find(chars + index, chars + length, '\n') - chars);
+                if (index < length)
+                    lineBreaks.push_back(++index);
+
+                continue;
+            }
+
             // Find out how many characters we can get on this line
             float width = 0;
             sf::Uint32 prevChar = 0;
-            for (std::size_t i = index; i < text.getSize(); ++i)
+            for (std::size_t i = index; i < length; ++i)
             {
                 float charWidth;
-                const sf::Uint32 curChar = text[i];
+                const sf::Uint32 curChar = chars[i];
                 if (curChar == '\n')
                 {
                     index++;
                     break;
                 }
                 else if (curChar == '\t')
-                    charWidth = font.getFont()->getGlyph(' ', textSize, bold).advance * 4;
+                    charWidth = metrics->getAdvance(' ') * 4;
                 else
-                    charWidth = font.getFont()->getGlyph(curChar, textSize, bold).advance;
+                    charWidth = metrics->getAdvance(curChar);
 
-                const float kerning = font.getFont()->getKerning(prevChar, curChar, textSize);
-                if ((maxWidth == 0) || (width + charWidth + kerning <= maxWidth))
+                const float kerning = metrics->getKerning(prevChar, curChar);
+                if (width + charWidth + kerning <= maxWidth)
                 {
                     width += kerning + charWidth;
                     index++;
@@ -311,13 +512,13 @@ namespace tgui
                 index++;
 
             // Implement the word-wrap by removing the last few characters from the line
-            if (text[index-1] != '\n')
+            if (chars[index-1] != '\n')
             {
                 const std::size_t indexWithoutWordWrap = index;
-                if ((index < text.getSize()) && (!isWhitespace(text[index])))
+                if ((index < length) && (!isWhitespace(chars[index])))
                 {
                     std::size_t wordWrapCorrection = 0;
-                    while ((index > oldIndex) && (!isWhitespace(text[index - 1])))
+                    while ((index > oldIndex) && (!isWhitespace(chars[index - 1])))
                     {
                         wordWrapCorrection++;
                         index--;
@@ -332,22 +533,49 @@ namespace tgui
             // If the next line starts with just a space, then the space need not be visible
             if (dropLeadingSpace)
             {
-                if ((index < text.getSize()) && (text[index] == ' '))
+                if ((index < length) && (chars[index] == ' '))
                 {
-                    if ((index == 0) || (!isWhitespace(text[index-1])))
+                    if ((index == 0) || (!isWhitespace(chars[index-1])))
                     {
                         // But two or more spaces indicate that it is not a normal text and the spaces should not be ignored
-                        if (((index + 1 < text.getSize()) && (!isWhitespace(text[index + 1]))) || (index + 1 == text.getSize()))
+                        if (((index + 1 < length) && (!isWhitespace(chars[index + 1]))) || (index + 1 == length))
                             index++;
                     }
                 }
             }
 
-            result += text.substring(oldIndex, index - oldIndex);
-            if ((index < text.getSize()) && (text[index-1] != '\n'))
-                result += "\n";
+            // A newline at the end of the text still starts a new (empty) line
+            if ((index < length) || (chars[index-1] == '\n'))
+                lineBreaks.push_back(index);
+        }
+
+        return lineBreaks;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::String Text::wordWrap(float maxWidth, const sf::String& text, Font font, unsigned int textSize, bool bold, bool dropLeadingSpace)
+    {
+        if (font == nullptr)
+            return "";
+
+        const std::vector<std::size_t> lineBreaks = findLineBreaks(maxWidth, text, font, textSize, bold, dropLeadingSpace);
+        const sf::Uint32* const chars = text.getData();
+
+        std::basic_string<sf::Uint32> result;
+        result.reserve(text.getSize() + lineBreaks.size());
+
+        std::size_t lineStart = 0;
+        for (const std::size_t lineBreak : lineBreaks)
+        {
+            result.append(chars + lineStart, lineBreak - lineStart);
+            if (chars[lineBreak - 1] != '\n')
+                result += '\n';
+
+            lineStart = lineBreak;
         }
 
+        result.append(chars + lineStart, text.getSize() - lineStart);
         return result;
     }
 
@@ -0,0 +1,153 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include <TGUI/TextDocument.hpp>
+
+#include <algorithm>
+#include <cstring>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    const std::size_t TextDocument::LinesPerCheckpoint;
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool TextDocument::open(const std::string& filename)
+    {
+        m_checkpoints.clear();
+        m_indexedLines = 0;
+        m_indexedBytes = 0;
+
+        if (!m_file.open(filename))
+            return false;
+
+        // The first line always starts at the beginning of the file, even when the file is empty
+        m_checkpoints.push_back(0);
+        m_indexedLines = 1;
+
+        // Skip the byte order mark
+        if ((m_file.getSize() >= 3) && (std::memcmp(m_file.getData(), "\xEF\xBB\xBF", 3) == 0))
+        {
+            m_checkpoints[0] = 3;
+            m_indexedBytes = 3;
+        }
+
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool TextDocument::buildIndex(std::size_t maxBytes)
+    {
+        const char* const data = m_file.getData();
+        const std::size_t end = std::min(m_file.getSize(), m_indexedBytes + maxBytes);
+        while (m_indexedBytes < end)
+        {
+            const void* newline = std::memchr(data + m_indexedBytes, '\n', end - m_indexedBytes);
+            if (!newline)
+            {
+                m_indexedBytes = end;
+                break;
+            }
+
+            m_indexedBytes = static_cast<std::size_t>(static_cast<const char*>(newline) - data) + 1;
+            if (m_indexedLines % LinesPerCheckpoint == 0)
+                m_checkpoints.push_back(m_indexedBytes);
+
+            ++m_indexedLines;
+        }
+
+        return isIndexComplete();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool TextDocument::isIndexComplete() const
+    {
+        return m_indexedBytes >= m_file.getSize();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t TextDocument::getLineCount() const
+    {
+        // The estimate is based on the lines of which the end has been found
+        if (isIndexComplete() || (m_indexedLines <= 1))
+            return m_indexedLines;
+
+        const double bytesPerLine = static_cast<double>(m_indexedBytes) / (m_indexedLines - 1);
+        return std::max(m_indexedLines, static_cast<std::size_t>(m_file.getSize() / bytesPerLine));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool TextDocument::readLine(std::size_t lineIndex, sf::String& line)
+    {
+        // Make sure that the end of the line is known, which is the case when the next line has been found
+        while ((m_indexedLines <= lineIndex + 1) && !isIndexComplete())
+            buildIndex(1024 * 1024);
+
+        if (lineIndex >= m_indexedLines)
+            return false;
+
+        // An empty file contains a single empty line
+        if (m_file.getSize() == 0)
+        {
+            line.clear();
+            return true;
+        }
+
+        // Scan forward from the last stored line position in front of the requested line
+        const char* const data = m_file.getData();
+        const char* const fileEnd = data + m_file.getSize();
+        const char* lineStart = data + m_checkpoints[lineIndex / LinesPerCheckpoint];
+        for (std::size_t i = 0; i < lineIndex % LinesPerCheckpoint; ++i)
+            lineStart = static_cast<const char*>(std::memchr(lineStart, '\n', fileEnd - lineStart)) + 1;
+
+        const char* lineEnd = static_cast<const char*>(std::memchr(lineStart, '\n', fileEnd - lineStart));
+        if (!lineEnd)
+            lineEnd = fileEnd;
+
+        // Windows line endings are reduced to a single newline
+        if ((lineEnd > lineStart) && (*(lineEnd - 1) == '\r'))
+            --lineEnd;
+
+        line = sf::String::fromUtf8(lineStart, lineEnd);
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t TextDocument::getSize() const
+    {
+        return m_file.getSize();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
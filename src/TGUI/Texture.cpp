@@ -158,10 +158,11 @@ namespace tgui
 
         m_data = nullptr;
         auto data = std::make_shared<TextureData>();
+        data->texture = std::make_shared<sf::Texture>(texture);
         if (partRect == sf::IntRect{})
-            data->texture = texture;
+            data->textureRect = {0, 0, static_cast<int>(texture.getSize().x), static_cast<int>(texture.getSize().y)};
         else
-            data->texture.loadFromImage(texture.copyToImage(), partRect);
+            data->textureRect = partRect;
 
         m_id = "";
         setTextureData(data, middleRect);
@@ -186,7 +187,7 @@ namespace tgui
     sf::Vector2f Texture::getImageSize() const
     {
         if (m_data)
-            return sf::Vector2f{m_data->texture.getSize()};
+            return {static_cast<float>(m_data->textureRect.width), static_cast<float>(m_data->textureRect.height)};
         else
             return {0,0};
     }
@@ -195,8 +196,24 @@ namespace tgui
 
     void Texture::setSmooth(bool smooth)
     {
-        if (m_data)
-            m_data->texture.setSmooth(smooth);
+        if (!m_data)
+            return;
+
+        // With smoothing, the pixels around the part would bleed into its edges and the filter would change for every other
+        // texture located on the same shared texture. The part is thus copied to a texture of its own first.
+        if (smooth && !m_data->separateTexture && m_data->image)
+        {
+            auto texture = std::make_shared<sf::Texture>();
+            if (texture->loadFromImage(*m_data->image, m_data->rect))
+            {
+                m_data->texture = std::move(texture);
+                m_data->textureRect = {0, 0, static_cast<int>(m_data->texture->getSize().x), static_cast<int>(m_data->texture->getSize().y)};
+                m_data->inAtlas = false;
+                m_data->separateTexture = true;
+            }
+        }
+
+        m_data->texture->setSmooth(smooth);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -204,7 +221,7 @@ namespace tgui
     bool Texture::isSmooth() const
     {
         if (m_data)
-            return m_data->texture.isSmooth();
+            return m_data->texture->isSmooth();
         else
             return false;
     }
@@ -223,7 +240,7 @@ namespace tgui
         if (!m_data || !m_data->image)
             return false;
 
-        assert(pixel.x < m_data->texture.getSize().x && pixel.y < m_data->texture.getSize().y);
+        assert(pixel.x < static_cast<unsigned int>(m_data->textureRect.width) && pixel.y < static_cast<unsigned int>(m_data->textureRect.height));
 
         if (m_data->image->getPixel(pixel.x + m_data->rect.left, pixel.y + m_data->rect.top).a == 0)
             return true;
@@ -285,7 +302,7 @@ namespace tgui
         m_data = data;
 
         if (middleRect == sf::IntRect{})
-            m_middleRect = {0, 0, static_cast<int>(m_data->texture.getSize().x), static_cast<int>(m_data->texture.getSize().y)};
+            m_middleRect = {0, 0, m_data->textureRect.width, m_data->textureRect.height};
         else
             m_middleRect = middleRect;
     }
@@ -27,11 +27,15 @@
 #include <TGUI/TextureManager.hpp>
 #include <TGUI/Exception.hpp>
 
+#include <algorithm>
+#include <cmath>
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
 {
     std::map<std::string, std::list<TextureDataHolder>> TextureManager::m_imageMap;
+    std::map<std::string, TextureManager::AtlasImage> TextureManager::m_atlasImages;
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -63,39 +67,85 @@ namespace tgui
             imageIt = it.first;
         }
 
+        // Find the image and the texture on which it is located
+        std::shared_ptr<sf::Image> image;
+        std::shared_ptr<sf::Texture> imageTexture;
+        sf::Vector2i offset;
+        bool inAtlas = false;
+        const auto atlasIt = m_atlasImages.find(filename);
+        if (atlasIt != m_atlasImages.end())
+        {
+            image = atlasIt->second.image;
+            imageTexture = atlasIt->second.texture;
+            offset = atlasIt->second.offset;
+            inAtlas = true;
+        }
+        else
+        {
+            // When another part of the same image was already loaded, its texture can be shared.
+            // Textures of an atlas that was removed are not reused, new parts get their own texture again.
+            // Smoothed parts have a texture that only contains that part, so they can't be shared either.
+            for (const auto& dataHolder : imageIt->second)
+            {
+                if (!dataHolder.data->inAtlas && !dataHolder.data->separateTexture)
+                {
+                    image = dataHolder.data->image;
+                    imageTexture = dataHolder.data->texture;
+                    break;
+                }
+            }
+        }
+
+        if (!imageTexture) // Load the image
+        {
+            image = texture.getImageLoader()(filename);
+            if (image != nullptr)
+            {
+                imageTexture = std::make_shared<sf::Texture>();
+                if (!imageTexture->loadFromImage(*image))
+                    image = nullptr;
+            }
+
+            // The image could not be loaded
+            if (image == nullptr)
+            {
+                if (imageIt->second.empty())
+                    m_imageMap.erase(imageIt);
+
+                return nullptr;
+            }
+        }
+
+        // Only use the requested part of the image, in the same way as sf::Texture::loadFromImage would do it
+        const sf::Vector2i imageSize{image->getSize()};
+        sf::IntRect rect = partRect;
+        if ((rect.width == 0) || (rect.height == 0))
+            rect = {0, 0, imageSize.x, imageSize.y};
+        else
+        {
+            rect.left = std::max(0, std::min(rect.left, imageSize.x));
+            rect.top = std::max(0, std::min(rect.top, imageSize.y));
+            rect.width = std::max(0, std::min(rect.width, imageSize.x - rect.left));
+            rect.height = std::max(0, std::min(rect.height, imageSize.y - rect.top));
+        }
+
         // Add new data to the list
         TextureDataHolder dataHolder;
         dataHolder.filename = filename;
         dataHolder.users = 1;
         dataHolder.data = std::make_shared<TextureData>();
+        dataHolder.data->image = image;
+        dataHolder.data->texture = imageTexture;
         dataHolder.data->rect = partRect;
+        dataHolder.data->textureRect = {rect.left + offset.x, rect.top + offset.y, rect.width, rect.height};
+        dataHolder.data->inAtlas = inAtlas;
         imageIt->second.push_back(std::move(dataHolder));
 
         // Let the texture alert the texture manager when it is being copied or destroyed
         texture.setCopyCallback(&TextureManager::copyTexture);
         texture.setDestructCallback(&TextureManager::removeTexture);
 
-        // Load the image
-        auto data = imageIt->second.back().data;
-        data->image = texture.getImageLoader()(filename);
-        if (data->image != nullptr)
-        {
-            // Create a texture from the image
-            bool loadFromImageSuccess;
-            if (partRect == sf::IntRect{})
-                loadFromImageSuccess = data->texture.loadFromImage(*data->image);
-            else
-                loadFromImageSuccess = data->texture.loadFromImage(*data->image, partRect);
-
-            if (loadFromImageSuccess)
-                return data;
-            else
-                return nullptr;
-        }
-
-        // The image could not be loaded
-        m_imageMap.erase(imageIt);
-        return nullptr;
+        return imageIt->second.back().data;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -149,6 +199,94 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool TextureManager::createAtlas(const std::vector<std::string>& filenames)
+    {
+        // Load all images that aren't part of an atlas yet
+        std::vector<std::pair<std::string, std::shared_ptr<sf::Image>>> images;
+        for (const auto& filename : filenames)
+        {
+            if (m_atlasImages.find(filename) != m_atlasImages.end())
+                continue;
+
+            if (std::find_if(images.begin(), images.end(), [&](const std::pair<std::string, std::shared_ptr<sf::Image>>& pair){ return pair.first == filename; }) != images.end())
+                continue;
+
+            std::shared_ptr<sf::Image> image = Texture::getImageLoader()(filename);
+            if (image && (image->getSize().x > 0) && (image->getSize().y > 0))
+                images.emplace_back(filename, std::move(image));
+        }
+
+        if (images.empty())
+            return false;
+
+        // Place the highest images first, so that each row is filled with images of similar height
+        std::sort(images.begin(), images.end(), [](const std::pair<std::string, std::shared_ptr<sf::Image>>& left, const std::pair<std::string, std::shared_ptr<sf::Image>>& right)
+            {
+                return left.second->getSize().y > right.second->getSize().y;
+            });
+
+        // Leave a transparent pixel between the images so that they don't bleed into each other when smoothing is enabled
+        const unsigned int padding = 1;
+
+        unsigned int area = 0;
+        unsigned int atlasWidth = 0;
+        for (const auto& pair : images)
+        {
+            area += (pair.second->getSize().x + padding) * (pair.second->getSize().y + padding);
+            atlasWidth = std::max(atlasWidth, pair.second->getSize().x + padding);
+        }
+
+        // Try to make the atlas roughly square
+        atlasWidth = std::max(atlasWidth, static_cast<unsigned int>(std::ceil(std::sqrt(static_cast<double>(area)))));
+        if (atlasWidth > sf::Texture::getMaximumSize())
+            return false;
+
+        // Fill the atlas row by row
+        std::vector<sf::Vector2u> positions;
+        sf::Vector2u position;
+        unsigned int rowHeight = 0;
+        for (const auto& pair : images)
+        {
+            if (position.x + pair.second->getSize().x > atlasWidth)
+            {
+                position.x = 0;
+                position.y += rowHeight;
+                rowHeight = 0;
+            }
+
+            positions.push_back(position);
+            position.x += pair.second->getSize().x + padding;
+            rowHeight = std::max(rowHeight, pair.second->getSize().y + padding);
+        }
+
+        const unsigned int atlasHeight = position.y + rowHeight;
+        if (atlasHeight > sf::Texture::getMaximumSize())
+            return false;
+
+        sf::Image atlasImage;
+        atlasImage.create(atlasWidth, atlasHeight, sf::Color::Transparent);
+        for (std::size_t i = 0; i < images.size(); ++i)
+            atlasImage.copy(*images[i].second, positions[i].x, positions[i].y);
+
+        auto atlasTexture = std::make_shared<sf::Texture>();
+        if (!atlasTexture->loadFromImage(atlasImage))
+            return false;
+
+        for (std::size_t i = 0; i < images.size(); ++i)
+            m_atlasImages[images[i].first] = {images[i].second, atlasTexture, sf::Vector2i{positions[i]}};
+
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextureManager::removeAtlases()
+    {
+        m_atlasImages.clear();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -27,7 +27,9 @@
 #include <TGUI/Container.hpp>
 #include <TGUI/Animation.hpp>
 #include <SFML/System/Err.hpp>
-#include <SFML/Graphics/RectangleShape.hpp>
+#include <TGUI/DrawBatch.hpp>
+
+#include <limits>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -90,6 +92,7 @@ namespace tgui
         m_allowFocus                   {other.m_allowFocus},
         m_draggableWidget              {other.m_draggableWidget},
         m_containerWidget              {other.m_containerWidget},
+        m_hitAreaInFullSize            {other.m_hitAreaInFullSize},
         m_toolTip                      {other.m_toolTip ? other.m_toolTip->clone() : nullptr},
         m_renderer                     {other.m_renderer},
         m_showAnimations               {other.m_showAnimations},
@@ -122,6 +125,7 @@ namespace tgui
         m_animationTimeElapsed         {std::move(other.m_animationTimeElapsed)},
         m_draggableWidget              {std::move(other.m_draggableWidget)},
         m_containerWidget              {std::move(other.m_containerWidget)},
+        m_hitAreaInFullSize            {std::move(other.m_hitAreaInFullSize)},
         m_toolTip                      {std::move(other.m_toolTip)},
         m_renderer                     {other.m_renderer},
         m_showAnimations               {std::move(other.m_showAnimations)},
@@ -164,6 +168,7 @@ namespace tgui
             m_animationTimeElapsed = {};
             m_draggableWidget      = other.m_draggableWidget;
             m_containerWidget      = other.m_containerWidget;
+            m_hitAreaInFullSize    = other.m_hitAreaInFullSize;
             m_toolTip              = other.m_toolTip ? other.m_toolTip->clone() : nullptr;
             m_renderer             = other.m_renderer;
             m_showAnimations       = {};
@@ -206,6 +211,7 @@ namespace tgui
             m_allowFocus           = std::move(other.m_allowFocus);
             m_draggableWidget      = std::move(other.m_draggableWidget);
             m_containerWidget      = std::move(other.m_containerWidget);
+            m_hitAreaInFullSize    = std::move(other.m_hitAreaInFullSize);
             m_toolTip              = std::move(other.m_toolTip);
             m_renderer             = std::move(other.m_renderer);
             m_showAnimations       = std::move(other.m_showAnimations);
@@ -230,6 +236,8 @@ namespace tgui
         if (m_parent && m_parent->getRenderer()->getFont() && (rendererData->propertyValuePairs.find("font") == rendererData->propertyValuePairs.end()))
             rendererData->propertyValuePairs["font"] = ObjectConverter(m_parent->getRenderer()->getFont());
 
+        invalidate();
+
         // Update the data
         m_renderer->unsubscribe(this);
         m_renderer->setData(rendererData);
@@ -270,6 +278,8 @@ namespace tgui
             rendererChanged(newIt->first);
             ++newIt;
         }
+
+        hitAreaChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -284,6 +294,8 @@ namespace tgui
     void Widget::setPosition(const Layout2d& position)
     {
         Transformable::setPosition(position);
+        invalidate();
+        hitAreaChanged();
 
         if (m_parent)
         {
@@ -304,6 +316,8 @@ namespace tgui
     void Widget::setSize(const Layout2d& size)
     {
         Transformable::setSize(size);
+        invalidate();
+        hitAreaChanged();
 
         if (m_parent)
         {
@@ -341,6 +355,8 @@ namespace tgui
     void Widget::show()
     {
         m_visible = true;
+        invalidate();
+        hitAreaChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -408,7 +424,10 @@ namespace tgui
 
     void Widget::hide()
     {
+        // The parent has to be informed before the widget becomes hidden
+        invalidate();
         m_visible = false;
+        hitAreaChanged();
 
         // If the widget is focused then it must be unfocused
         unfocus();
@@ -471,6 +490,7 @@ namespace tgui
     void Widget::enable()
     {
         m_enabled = true;
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -482,6 +502,7 @@ namespace tgui
         // Change the mouse button state.
         m_mouseHover = false;
         m_mouseDown = false;
+        invalidate();
 
         // If the widget is focused then it must be unfocused
         unfocus();
@@ -542,6 +563,15 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Widget::invalidate()
+    {
+        // Changes to hidden widgets don't change what the parent looks like
+        if (m_parent && m_visible)
+            m_parent->invalidate();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Widget::setParent(Container* parent)
     {
         m_parent = parent;
@@ -555,6 +585,10 @@ namespace tgui
     {
         m_animationTimeElapsed += elapsedTime;
 
+        // The widget changes every frame while it is being animated
+        if (!m_showAnimations.empty())
+            invalidate();
+
         for (unsigned int i = 0; i < m_showAnimations.size();)
         {
             if (m_showAnimations[i]->update(elapsedTime))
@@ -566,6 +600,16 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    sf::Time Widget::timeUntilNextUpdate() const
+    {
+        if (!m_showAnimations.empty())
+            return sf::Time::Zero;
+        else
+            return sf::microseconds(std::numeric_limits<sf::Int64>::max());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Widget::leftMousePressed(sf::Vector2f)
     {
     }
@@ -606,6 +650,7 @@ namespace tgui
 
     void Widget::widgetFocused()
     {
+        invalidate();
         onFocus.emit(this);
 
         // Make sure the parent is also focused
@@ -617,6 +662,7 @@ namespace tgui
 
     void Widget::widgetUnfocused()
     {
+        invalidate();
         onUnfocus.emit(this);
     }
 
@@ -632,7 +678,11 @@ namespace tgui
 
     void Widget::mouseNoLongerDown()
     {
-        m_mouseDown = false;
+        if (m_mouseDown)
+        {
+            m_mouseDown = false;
+            invalidate();
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -663,6 +713,13 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    sf::FloatRect Widget::getDrawBounds() const
+    {
+        return {getPosition() + getWidgetOffset(), getFullSize()};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     Signal& Widget::getSignal(std::string&& signalName)
     {
         if (signalName == toLower(onPositionChange.getName()))
@@ -698,6 +755,7 @@ namespace tgui
     void Widget::mouseEnteredWidget()
     {
         m_mouseHover = true;
+        invalidate();
         onMouseEnter.emit(this);
     }
 
@@ -706,6 +764,7 @@ namespace tgui
     void Widget::mouseLeftWidget()
     {
         m_mouseHover = false;
+        invalidate();
         onMouseLeave.emit(this);
     }
 
@@ -714,6 +773,18 @@ namespace tgui
     void Widget::rendererChangedCallback(const std::string& property)
     {
         rendererChanged(property);
+        invalidate();
+
+        // Renderer properties such as borders or text sizes can change the full size of the widget
+        hitAreaChanged();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Widget::hitAreaChanged()
+    {
+        if (m_parent)
+            m_parent->m_hitTestGridValid = false;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -723,14 +794,17 @@ namespace tgui
                                     sf::Vector2f size,
                                     sf::Color color) const
     {
-        sf::RectangleShape shape{size};
-
         if (m_opacityCached < 1)
-            shape.setFillColor(Color::calcColorOpacity(color, m_opacityCached));
-        else
-            shape.setFillColor(color);
+            color = Color::calcColorOpacity(color, m_opacityCached);
 
-        target.draw(shape, states);
+        const sf::Vertex vertices[] = {
+            {{0, 0}, color},
+            {{0, size.y}, color},
+            {{size.x, 0}, color},
+            {{size.x, size.y}, color}
+        };
+
+        DrawBatch::draw(target, vertices, 4, sf::PrimitiveType::TrianglesStrip, states);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -746,10 +820,14 @@ namespace tgui
         // If size is too small then draw entire size as border
         if ((size.x <= borders.getLeft() + borders.getRight()) || (size.y <= borders.getTop() + borders.getBottom()))
         {
-            sf::RectangleShape border;
-            border.setFillColor(color);
-            border.setSize({size.x, size.y});
-            target.draw(border, states);
+            const sf::Vertex vertices[] = {
+                {{0, 0}, color},
+                {{0, size.y}, color},
+                {{size.x, 0}, color},
+                {{size.x, size.y}, color}
+            };
+
+            DrawBatch::draw(target, vertices, 4, sf::PrimitiveType::TrianglesStrip, states);
         }
         else // Draw borders in the normal way
         {
@@ -763,7 +841,7 @@ namespace tgui
             // |              | //
             // 2--------------4 //
             //////////////////////
-            const std::vector<sf::Vertex> vertices = {
+            const sf::Vertex vertices[] = {
                 {{0, 0}, color},
                 {{borders.getLeft(), 0}, color},
                 {{0, size.y}, color},
@@ -776,7 +854,7 @@ namespace tgui
                 {{borders.getLeft(), borders.getTop()}, color}
             };
 
-            target.draw(vertices.data(), vertices.size(), sf::PrimitiveType::TrianglesStrip, states);
+            DrawBatch::draw(target, vertices, 10, sf::PrimitiveType::TrianglesStrip, states);
         }
     }
 
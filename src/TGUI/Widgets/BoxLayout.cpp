@@ -71,6 +71,8 @@ namespace tgui
 
             m_widgets.insert(m_widgets.begin() + index, widget);
             m_widgetNames.insert(m_widgetNames.begin() + index, widgetName);
+
+            updateWidgetOrder(index);
         }
         else // Just add the widget to the back
             Group::add(widget, widgetName);
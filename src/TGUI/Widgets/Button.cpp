@@ -118,6 +118,7 @@ namespace tgui
 
     void Button::setText(const sf::String& text)
     {
+        invalidate();
         m_string = text;
 
         // Set the text size when the text has a fixed size
@@ -175,6 +176,7 @@ namespace tgui
 
     void Button::setTextSize(unsigned int size)
     {
+        invalidate();
         if (size != m_textSize)
         {
             m_textSize = size;
@@ -387,6 +389,7 @@ namespace tgui
 
     void Button::updateTextColorAndStyle()
     {
+        invalidate();
         if (!m_enabled && getRenderer()->getTextStyleDisabled().isSet())
             m_text.setStyle(getRenderer()->getTextStyleDisabled());
         else if (m_mouseHover && m_mouseDown && getRenderer()->getTextStyleDown().isSet())
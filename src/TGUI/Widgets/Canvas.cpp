@@ -24,6 +24,7 @@
 
 
 #include <TGUI/Widgets/Canvas.hpp>
+#include <TGUI/DrawBatch.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -120,6 +121,7 @@ namespace tgui
 
     void Canvas::clear(Color color)
     {
+        invalidate();
         m_renderTexture.clear(color);
     }
 
@@ -141,6 +143,7 @@ namespace tgui
 
     void Canvas::display()
     {
+        invalidate();
         m_renderTexture.display();
     }
 
@@ -159,7 +162,7 @@ namespace tgui
     void Canvas::draw(sf::RenderTarget& target, sf::RenderStates states) const
     {
         states.transform.translate(getPosition());
-        target.draw(m_sprite, states);
+        DrawBatch::draw(target, m_sprite, states);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -25,6 +25,9 @@
 
 #include <TGUI/Widgets/ChatBox.hpp>
 #include <TGUI/Clipping.hpp>
+#include <TGUI/FontMetrics.hpp>
+
+#include <algorithm>
 
 /// TODO: Same font for all lines?
 
@@ -120,41 +123,86 @@ namespace tgui
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void ChatBox::addLine(const sf::String& text, const sf::Color& color, unsigned int textSize, const Font& font)
+    {
+        insertLine(text, color, textSize, font);
+
+        recalculateFullTextHeight();
+        updateVisibleLines();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ChatBox::queueLine(const sf::String& text)
+    {
+        auto line = std::make_unique<QueuedLine>();
+        line->text = text;
+        m_queuedLines.push(std::move(line));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ChatBox::queueLine(const sf::String& text, unsigned int textSize)
+    {
+        auto line = std::make_unique<QueuedLine>();
+        line->text = text;
+        line->textSize = textSize;
+        line->useDefaultTextSize = false;
+        m_queuedLines.push(std::move(line));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ChatBox::queueLine(const sf::String& text, const sf::Color& color)
+    {
+        auto line = std::make_unique<QueuedLine>();
+        line->text = text;
+        line->color = color;
+        line->useDefaultColor = false;
+        m_queuedLines.push(std::move(line));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ChatBox::queueLine(const sf::String& text, const sf::Color& color, unsigned int textSize, const Font& font)
+    {
+        auto line = std::make_unique<QueuedLine>();
+        line->text = text;
+        line->color = color;
+        line->textSize = textSize;
+        line->font = font;
+        line->useDefaultColor = false;
+        line->useDefaultTextSize = false;
+        m_queuedLines.push(std::move(line));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ChatBox::insertLine(const sf::String& text, const sf::Color& color, unsigned int textSize, const Font& font)
     {
         // Remove the oldest line if you exceed the maximum
-        if ((m_maxLines > 0) && (m_maxLines == m_lines.size()))
-        {
-            if (m_newLinesBelowOthers)
-                removeLine(0);
-            else
-                removeLine(m_maxLines-1);
-        }
+        if ((m_maxLines > 0) && (m_maxLines == m_lineCount))
+            popLine(!m_newLinesBelowOthers);
 
         Line line;
         line.string = text;
-        line.text.setColor(color);
-        line.text.setOpacity(m_opacityCached);
-        line.text.setCharacterSize(textSize);
-        line.text.setString(text);
-        line.text.setFont(font != nullptr ? font : m_fontCached);
+        line.color = color;
+        line.textSize = textSize;
+        line.font = (font != nullptr) ? font : m_fontCached;
+        line.id = m_nextLineId++;
 
-        recalculateLineText(line);
+        // The line isn't wrapped yet, that only happens when it comes near the visible area
+        line.height = estimateLineHeight(line);
 
-        if (m_newLinesBelowOthers)
-            m_lines.push_back(std::move(line));
-        else
-            m_lines.push_front(std::move(line));
-
-        recalculateFullTextHeight();
+        pushLine(std::move(line), m_newLinesBelowOthers);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     sf::String ChatBox::getLine(std::size_t lineIndex) const
     {
-        if (lineIndex < m_lines.size())
+        if (lineIndex < m_lineCount)
         {
-            return m_lines[lineIndex].string;
+            return getLineAt(lineIndex).string;
         }
         else // Index too high
             return "";
@@ -164,9 +212,9 @@ namespace tgui
 
     sf::Color ChatBox::getLineColor(std::size_t lineIndex) const
     {
-        if (lineIndex < m_lines.size())
+        if (lineIndex < m_lineCount)
         {
-            return m_lines[lineIndex].text.getColor();
+            return getLineAt(lineIndex).color;
         }
         else // Index too high
             return m_textColor;
@@ -176,9 +224,9 @@ namespace tgui
 
     unsigned int ChatBox::getLineTextSize(std::size_t lineIndex) const
     {
-        if (lineIndex < m_lines.size())
+        if (lineIndex < m_lineCount)
         {
-            return m_lines[lineIndex].text.getCharacterSize();
+            return getLineAt(lineIndex).textSize;
         }
         else // Index too high
             return m_textSize;
@@ -188,9 +236,9 @@ namespace tgui
 
     std::shared_ptr<sf::Font> ChatBox::getLineFont(std::size_t lineIndex) const
     {
-        if (lineIndex < m_lines.size())
+        if (lineIndex < m_lineCount)
         {
-            return m_lines[lineIndex].text.getFont();
+            return getLineAt(lineIndex).font;
         }
         else // Index too high
             return m_fontCached;
@@ -200,11 +248,25 @@ namespace tgui
 
     bool ChatBox::removeLine(std::size_t lineIndex)
     {
-        if (lineIndex < m_lines.size())
+        if (lineIndex < m_lineCount)
         {
-            m_lines.erase(m_lines.begin() + lineIndex);
+            if (lineIndex == 0)
+                popLine(false);
+            else if (lineIndex == m_lineCount - 1)
+                popLine(true);
+            else
+            {
+                // Shift the lines below the removed line upwards
+                for (std::size_t i = lineIndex; i + 1 < m_lineCount; ++i)
+                    getLineAt(i) = std::move(getLineAt(i + 1));
+
+                getLineAt(m_lineCount - 1).height = 0;
+                popLine(true);
+                rebuildHeightTree();
+            }
 
             recalculateFullTextHeight();
+            updateVisibleLines();
             return true;
         }
         else // Index too high
@@ -216,15 +278,19 @@ namespace tgui
     void ChatBox::removeAllLines()
     {
         m_lines.clear();
+        m_heightTree.clear();
+        m_firstLine = 0;
+        m_lineCount = 0;
 
         recalculateFullTextHeight();
+        updateVisibleLines();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     std::size_t ChatBox::getLineAmount()
     {
-        return m_lines.size();
+        return m_lineCount;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -234,15 +300,21 @@ namespace tgui
         m_maxLines = maxLines;
 
         // Remove the oldest lines if there are too many lines
-        if ((m_maxLines > 0) && (m_maxLines < m_lines.size()))
+        if ((m_maxLines > 0) && (m_maxLines < m_lineCount))
         {
-            if (m_newLinesBelowOthers)
-                m_lines.erase(m_lines.begin(), m_lines.begin() + m_lines.size() - m_maxLines);
-            else
-                m_lines.erase(m_lines.begin() + m_maxLines, m_lines.end());
+            while (m_lineCount > m_maxLines)
+                popLine(!m_newLinesBelowOthers);
 
             recalculateFullTextHeight();
+            updateVisibleLines();
         }
+
+        // The ring buffer never has to be larger than the limit
+        if ((m_maxLines > 0) && (m_maxLines < m_lines.size()))
+            reserveLines(m_maxLines);
+
+        // Lines queued while the chat box is hidden can't all be shown either
+        m_queuedLines.setCapacity(m_maxLines);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -254,6 +326,16 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void ChatBox::show()
+    {
+        Widget::show();
+
+        // Hidden widgets aren't updated, so the lines that were queued in the meantime haven't been added yet
+        addQueuedLines();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void ChatBox::setTextSize(unsigned int size)
     {
         // Store the new text size
@@ -277,6 +359,7 @@ namespace tgui
 
     void ChatBox::setTextColor(Color color)
     {
+        invalidate();
         m_textColor = color;
     }
 
@@ -291,6 +374,7 @@ namespace tgui
 
     void ChatBox::setLinesStartFromTop(bool startFromTop)
     {
+        invalidate();
         if (m_linesStartFromTop != startFromTop)
             m_linesStartFromTop = startFromTop;
     }
@@ -306,6 +390,7 @@ namespace tgui
 
     void ChatBox::setNewLinesBelowOthers(bool newLinesBelowOthers)
     {
+        invalidate();
         m_newLinesBelowOthers = newLinesBelowOthers;
     }
 
@@ -332,7 +417,15 @@ namespace tgui
 
         // Pass the event to the scrollbar
         if (m_scroll.mouseOnWidget(pos - getPosition()))
+        {
+            const unsigned int oldValue = m_scroll.getValue();
             m_scroll.leftMousePressed(pos - getPosition());
+            if (m_scroll.getValue() != oldValue)
+                updateVisibleLines();
+        }
+
+        if (m_scroll.wasInvalidated())
+            invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -340,7 +433,15 @@ namespace tgui
     void ChatBox::leftMouseReleased(sf::Vector2f pos)
     {
         if (m_scroll.isMouseDown())
+        {
+            const unsigned int oldValue = m_scroll.getValue();
             m_scroll.leftMouseReleased(pos - getPosition());
+            if (m_scroll.getValue() != oldValue)
+                updateVisibleLines();
+        }
+
+        if (m_scroll.wasInvalidated())
+            invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -352,9 +453,17 @@ namespace tgui
 
         // Pass the event to the scrollbar when the mouse is on top of it or when we are dragging its thumb
         if (((m_scroll.isMouseDown()) && (m_scroll.isMouseDownOnThumb())) || m_scroll.mouseOnWidget(pos - getPosition()))
+        {
+            const unsigned int oldValue = m_scroll.getValue();
             m_scroll.mouseMoved(pos - getPosition());
+            if (m_scroll.getValue() != oldValue)
+                updateVisibleLines();
+        }
         else
             m_scroll.mouseNoLongerOnWidget();
+
+        if (m_scroll.wasInvalidated())
+            invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -363,6 +472,9 @@ namespace tgui
     {
         Widget::mouseNoLongerOnWidget();
         m_scroll.mouseNoLongerOnWidget();
+
+        if (m_scroll.wasInvalidated())
+            invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -371,6 +483,29 @@ namespace tgui
     {
         Widget::mouseNoLongerDown();
         m_scroll.mouseNoLongerDown();
+
+        if (m_scroll.wasInvalidated())
+            invalidate();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ChatBox::update(sf::Time elapsedTime)
+    {
+        Widget::update(elapsedTime);
+
+        addQueuedLines();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::Time ChatBox::timeUntilNextUpdate() const
+    {
+        // The gui shouldn't wait for an event before adding lines that were queued from another thread
+        if (!m_queuedLines.isEmpty())
+            return sf::Time::Zero;
+
+        return Widget::timeUntilNextUpdate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -378,40 +513,275 @@ namespace tgui
     void ChatBox::mouseWheelScrolled(float delta, sf::Vector2f pos)
     {
         if (m_scroll.getLowValue() < m_scroll.getMaximum())
+        {
+            const unsigned int oldValue = m_scroll.getValue();
             m_scroll.mouseWheelScrolled(delta, pos - getPosition());
+            if (m_scroll.getValue() != oldValue)
+                updateVisibleLines();
+        }
+
+        if (m_scroll.wasInvalidated())
+            invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void ChatBox::recalculateLineText(Line& line)
+    ChatBox::Line& ChatBox::getLineAt(std::size_t lineIndex)
     {
-        line.text.setString("");
+        return m_lines[(m_firstLine + lineIndex) % m_lines.size()];
+    }
 
-        // Find the maximum width of one line
-        const float maxWidth = getInnerSize().x - m_scroll.getSize().x - m_paddingCached.getLeft() - m_paddingCached.getRight();
-        if (maxWidth < 0)
-            return;
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const ChatBox::Line& ChatBox::getLineAt(std::size_t lineIndex) const
+    {
+        return m_lines[(m_firstLine + lineIndex) % m_lines.size()];
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ChatBox::pushLine(Line&& line, bool back)
+    {
+        if (m_lineCount == m_lines.size())
+        {
+            std::size_t capacity = std::max<std::size_t>(16, 2 * m_lines.size());
+            if (m_maxLines > 0)
+                capacity = std::max(std::min(capacity, m_maxLines), m_lineCount + 1);
+
+            reserveLines(capacity);
+        }
+
+        std::size_t slot;
+        if (back)
+            slot = (m_firstLine + m_lineCount) % m_lines.size();
+        else
+        {
+            m_firstLine = (m_firstLine + m_lines.size() - 1) % m_lines.size();
+            slot = m_firstLine;
+        }
+
+        addToHeightTree(slot, line.height);
+        m_lines[slot] = std::move(line);
+        ++m_lineCount;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ChatBox::popLine(bool back)
+    {
+        const std::size_t slot = back ? (m_firstLine + m_lineCount - 1) % m_lines.size() : m_firstLine;
+        addToHeightTree(slot, -m_lines[slot].height);
+
+        // Release the memory used by the string, the slot will be reused later
+        m_lines[slot] = Line{};
+
+        if (!back)
+            m_firstLine = (m_firstLine + 1) % m_lines.size();
+
+        --m_lineCount;
+
+        // Don't let rounding errors accumulate in the tree
+        if (m_lineCount == 0)
+        {
+            m_firstLine = 0;
+            std::fill(m_heightTree.begin(), m_heightTree.end(), 0);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ChatBox::reserveLines(std::size_t capacity)
+    {
+        std::vector<Line> lines(capacity);
+        for (std::size_t i = 0; i < m_lineCount; ++i)
+            lines[i] = std::move(getLineAt(i));
+
+        m_lines = std::move(lines);
+        m_firstLine = 0;
+        rebuildHeightTree();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ChatBox::rebuildHeightTree()
+    {
+        // The tree is build in linear time by passing each partial sum to its parent
+        m_heightTree.assign(m_lines.size() + 1, 0);
+        for (std::size_t i = 1; i < m_heightTree.size(); ++i)
+        {
+            m_heightTree[i] += m_lines[i - 1].height;
+
+            const std::size_t parent = i + (i & (~i + 1));
+            if (parent < m_heightTree.size())
+                m_heightTree[parent] += m_heightTree[i];
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ChatBox::addToHeightTree(std::size_t slot, double height)
+    {
+        for (std::size_t i = slot + 1; i < m_heightTree.size(); i += (i & (~i + 1)))
+            m_heightTree[i] += height;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    double ChatBox::getHeightOfSlots(std::size_t slotCount) const
+    {
+        double height = 0;
+        for (std::size_t i = slotCount; i > 0; i -= (i & (~i + 1)))
+            height += m_heightTree[i];
+
+        return height;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t ChatBox::findSlotsWithinHeight(double height) const
+    {
+        if (m_heightTree.size() <= 1)
+            return 0;
+
+        std::size_t step = 1;
+        while (step * 2 < m_heightTree.size())
+            step *= 2;
+
+        std::size_t slotCount = 0;
+        for (; step > 0; step /= 2)
+        {
+            if ((slotCount + step < m_heightTree.size()) && (m_heightTree[slotCount + step] <= height))
+            {
+                slotCount += step;
+                height -= m_heightTree[slotCount];
+            }
+        }
+
+        return slotCount;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        line.text.setString(Text::wordWrap(maxWidth, line.string, line.text.getFont(), line.text.getCharacterSize(), false));
+    float ChatBox::getHeightAboveLine(std::size_t lineIndex) const
+    {
+        const std::size_t end = m_firstLine + lineIndex;
+        if (end <= m_lines.size())
+            return static_cast<float>(getHeightOfSlots(end) - getHeightOfSlots(m_firstLine));
+        else // The lines wrap around the end of the ring buffer
+            return static_cast<float>(getHeightOfSlots(m_lines.size()) - getHeightOfSlots(m_firstLine) + getHeightOfSlots(end - m_lines.size()));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t ChatBox::findLineAtHeight(float height) const
+    {
+        if (m_lineCount == 0)
+            return 0;
+
+        if (height <= 0)
+            return 0;
+
+        // The lines are stored in two parts when they wrap around the end of the ring buffer
+        const double heightBeforeFirstLine = getHeightOfSlots(m_firstLine);
+        const double heightOfFirstPart = getHeightOfSlots(std::min(m_lines.size(), m_firstLine + m_lineCount)) - heightBeforeFirstLine;
+
+        std::size_t lineIndex;
+        if (height < heightOfFirstPart)
+            lineIndex = std::max(findSlotsWithinHeight(heightBeforeFirstLine + height), m_firstLine) - m_firstLine;
+        else
+            lineIndex = findSlotsWithinHeight(height - heightOfFirstPart) + (m_lines.size() - m_firstLine);
+
+        return std::min(lineIndex, m_lineCount - 1);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ChatBox::setLineHeight(std::size_t lineIndex, float height)
+    {
+        Line& line = getLineAt(lineIndex);
+        addToHeightTree((m_firstLine + lineIndex) % m_lines.size(), static_cast<double>(height) - line.height);
+        line.height = height;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    float ChatBox::estimateLineHeight(const Line& line) const
+    {
+        if (line.font == nullptr)
+            return 0;
+
+        const FontMetrics& metrics = FontMetrics::get(line.font, line.textSize, false);
+        const std::size_t lines = 1 + std::count(line.string.begin(), line.string.end(), '\n');
+        return lines * metrics.getLineSpacing() + metrics.getExtraVerticalSpace();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    float ChatBox::calculateLineHeight(const Line& line) const
+    {
+        if (line.font == nullptr)
+            return 0;
+
+        std::size_t lines = 1;
+        const float maxWidth = getMaximumLineWidth();
+        if (maxWidth >= 0)
+            lines += Text::findLineBreaks(maxWidth, line.string, line.font, line.textSize, false).size();
+
+        const FontMetrics& metrics = FontMetrics::get(line.font, line.textSize, false);
+        return lines * metrics.getLineSpacing() + metrics.getExtraVerticalSpace();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    float ChatBox::getMaximumLineWidth() const
+    {
+        return getInnerSize().x - m_scroll.getSize().x - m_paddingCached.getLeft() - m_paddingCached.getRight();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void ChatBox::recalculateAllLines()
     {
-        for (auto& line : m_lines)
-            recalculateLineText(line);
+        // The lines keep their current height as estimate until they get near the visible area again
+        ++m_wrapGeneration;
+        m_wrapWidth = getMaximumLineWidth();
+
+        updateVisibleLines();
+    }
 
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ChatBox::addQueuedLines()
+    {
+        const std::vector<std::unique_ptr<QueuedLine>> queuedLines = m_queuedLines.takeAll();
+        if (queuedLines.empty())
+            return;
+
+        // Lines that would be removed again by the line limit before the end of the batch aren't added at all
+        std::size_t firstLine = 0;
+        if ((m_maxLines > 0) && (queuedLines.size() > m_maxLines))
+            firstLine = queuedLines.size() - m_maxLines;
+
+        for (std::size_t i = firstLine; i < queuedLines.size(); ++i)
+        {
+            const QueuedLine& line = *queuedLines[i];
+            insertLine(line.text,
+                       line.useDefaultColor ? m_textColor : line.color,
+                       line.useDefaultTextSize ? m_textSize : line.textSize,
+                       line.font);
+        }
+
+        // The scrollbar and visible lines are only updated once for the whole batch
         recalculateFullTextHeight();
+        updateVisibleLines();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void ChatBox::recalculateFullTextHeight()
     {
-        m_fullTextHeight = 0;
-        for (const auto& line : m_lines)
-            m_fullTextHeight += line.text.getSize().y;
+        invalidate();
+        m_fullTextHeight = getHeightAboveLine(m_lineCount);
 
         // Update the maximum of the scrollbar
         const unsigned int oldMaximum = m_scroll.getMaximum();
@@ -435,7 +805,101 @@ namespace tgui
         m_scroll.setSize({m_scroll.getSize().x, getInnerSize().y - m_paddingCached.getTop() - m_paddingCached.getBottom()});
         m_scroll.setLowValue(static_cast<unsigned int>(getInnerSize().y - m_paddingCached.getTop() - m_paddingCached.getBottom()));
 
-        recalculateAllLines();
+        // Changing the height doesn't require the lines to be wrapped again
+        if (getMaximumLineWidth() != m_wrapWidth)
+            recalculateAllLines();
+        else
+        {
+            recalculateFullTextHeight();
+            updateVisibleLines();
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ChatBox::updateVisibleLines()
+    {
+        const float visibleHeight = getInnerSize().y - m_paddingCached.getTop() - m_paddingCached.getBottom();
+
+        // Wrap the lines that are visible and the lines within one screen above or below them. Wrapping a line may change its
+        // height, so the lines near the visible area are searched again until they are all wrapped.
+        bool heightsChanged = (m_lineCount > 0);
+        while (heightsChanged)
+        {
+            heightsChanged = false;
+
+            const float top = static_cast<float>(m_scroll.getValue());
+            const std::size_t firstVisibleLine = findLineAtHeight(top);
+            const std::size_t firstLine = findLineAtHeight(top - visibleHeight);
+            const std::size_t lastLine = findLineAtHeight(top + 2 * visibleHeight);
+
+            float heightChangeAbove = 0;
+            for (std::size_t i = firstLine; i <= lastLine; ++i)
+            {
+                Line& line = getLineAt(i);
+                if (line.wrapGeneration == m_wrapGeneration)
+                    continue;
+
+                line.wrapGeneration = m_wrapGeneration;
+
+                const float oldHeight = line.height;
+                setLineHeight(i, calculateLineHeight(line));
+                if (line.height != oldHeight)
+                {
+                    heightsChanged = true;
+                    if (i < firstVisibleLine)
+                        heightChangeAbove += line.height - oldHeight;
+                }
+            }
+
+            if (heightsChanged)
+            {
+                // Lines above the visible area that changed height should not move the visible lines
+                const unsigned int oldValue = m_scroll.getValue();
+                const bool scrolledToBottom = m_newLinesBelowOthers && (m_scroll.getMaximum() >= m_scroll.getLowValue())
+                                           && (oldValue == m_scroll.getMaximum() - m_scroll.getLowValue());
+
+                recalculateFullTextHeight();
+
+                if (!scrolledToBottom && (heightChangeAbove != 0))
+                    m_scroll.setValue(static_cast<unsigned int>(std::max(0.f, oldValue + heightChangeAbove)));
+            }
+        }
+
+        // Create the texts of the visible lines, reusing the texts that were already visible
+        std::vector<VisibleLine> oldVisibleLines;
+        oldVisibleLines.swap(m_visibleLines);
+        m_visibleLinesTop = 0;
+        if (m_lineCount == 0)
+            return;
+
+        const float top = static_cast<float>(m_scroll.getValue());
+        const std::size_t firstVisibleLine = findLineAtHeight(top);
+        const std::size_t lastVisibleLine = findLineAtHeight(top + visibleHeight);
+        m_visibleLinesTop = getHeightAboveLine(firstVisibleLine);
+
+        const float maxWidth = getMaximumLineWidth();
+        for (std::size_t i = firstVisibleLine; i <= lastVisibleLine; ++i)
+        {
+            const Line& line = getLineAt(i);
+            const auto it = std::find_if(oldVisibleLines.begin(), oldVisibleLines.end(),
+                                         [&](const VisibleLine& visibleLine){ return (visibleLine.id == line.id) && (visibleLine.wrapGeneration == line.wrapGeneration); });
+            if (it != oldVisibleLines.end())
+            {
+                m_visibleLines.push_back(std::move(*it));
+                continue;
+            }
+
+            VisibleLine visibleLine{line.id, line.wrapGeneration, line.height, {}};
+            visibleLine.text.setColor(line.color);
+            visibleLine.text.setOpacity(m_opacityCached);
+            visibleLine.text.setCharacterSize(line.textSize);
+            visibleLine.text.setFont(line.font);
+            if (maxWidth >= 0)
+                visibleLine.text.setString(Text::wordWrap(maxWidth, line.string, line.font, line.textSize, false));
+
+            m_visibleLines.push_back(std::move(visibleLine));
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -475,7 +939,7 @@ namespace tgui
             m_spriteBackground.setOpacity(m_opacityCached);
             m_scroll.getRenderer()->setOpacity(m_opacityCached);
 
-            for (auto& line : m_lines)
+            for (auto& line : m_visibleLines)
                 line.text.setOpacity(m_opacityCached);
         }
         else if (property == "font")
@@ -486,17 +950,22 @@ namespace tgui
             {
                 // Look for lines that did not have a font yet and give them this font
                 bool lineChanged = false;
-                for (auto& line : m_lines)
+                for (std::size_t i = 0; i < m_lineCount; ++i)
                 {
-                    if (line.text.getFont() == nullptr)
+                    Line& line = getLineAt(i);
+                    if (line.font == nullptr)
                     {
-                        line.text.setFont(m_fontCached);
+                        line.font = m_fontCached;
+                        setLineHeight(i, estimateLineHeight(line));
                         lineChanged = true;
                     }
                 }
 
                 if (lineChanged)
+                {
+                    recalculateFullTextHeight();
                     recalculateAllLines();
+                }
             }
         }
         else
@@ -546,11 +1015,147 @@ namespace tgui
         if (!m_linesStartFromTop && (m_fullTextHeight < getInnerSize().y - m_paddingCached.getTop() - m_paddingCached.getBottom()))
             states.transform.translate(0, getInnerSize().y - m_paddingCached.getTop() - m_paddingCached.getBottom() - m_fullTextHeight);
 
-        for (const auto& line : m_lines)
+        // Only the lines inside the visible area are drawn
+        states.transform.translate(0, m_visibleLinesTop);
+        for (const auto& line : m_visibleLines)
         {
             line.text.draw(target, states);
-            states.transform.translate(0, line.text.getSize().y);
+            states.transform.translate(0, line.height);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    ChatBox::LineQueue::~LineQueue()
+    {
+        takeAll();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    ChatBox::LineQueue::LineQueue(const LineQueue& other) :
+        m_capacity{other.m_capacity.load()}
+    {
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    ChatBox::LineQueue& ChatBox::LineQueue::operator=(const LineQueue& other)
+    {
+        m_capacity = other.m_capacity.load();
+        return *this;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ChatBox::LineQueue::push(std::unique_ptr<QueuedLine> line)
+    {
+        // The size is increased first so that it is never smaller than the amount of lines in the list
+        const std::size_t size = m_size.fetch_add(1, std::memory_order_relaxed) + 1;
+
+        // The line is put in front of the list, retrying when another thread changed the head in the meantime
+        QueuedLine* const node = line.release();
+        node->next = m_head.load(std::memory_order_relaxed);
+        while (!m_head.compare_exchange_weak(node->next, node, std::memory_order_release, std::memory_order_relaxed))
+            ;
+
+        // The queue only grows this large when nobody is taking lines out of it (e.g. because the chat box is hidden)
+        const std::size_t capacity = m_capacity.load(std::memory_order_relaxed);
+        if ((capacity > 0) && (size > 2 * capacity))
+            trim(capacity);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::vector<std::unique_ptr<ChatBox::QueuedLine>> ChatBox::LineQueue::takeAll()
+    {
+        // If another thread is trimming the list then it holds some of the lines, taking the rest would mix up the order
+        if (m_busy.exchange(true, std::memory_order_acquire))
+            return {};
+
+        // Taking the whole list at once means that nodes are never removed while other threads are pushing
+        QueuedLine* node = m_head.exchange(nullptr, std::memory_order_acquire);
+
+        std::vector<std::unique_ptr<QueuedLine>> lines;
+        while (node)
+        {
+            QueuedLine* const next = node->next;
+            lines.emplace_back(node);
+            node = next;
+        }
+
+        m_size.fetch_sub(lines.size(), std::memory_order_relaxed);
+        m_busy.store(false, std::memory_order_release);
+
+        // The list contains the newest line first
+        std::reverse(lines.begin(), lines.end());
+        return lines;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool ChatBox::LineQueue::isEmpty() const
+    {
+        return m_head.load(std::memory_order_relaxed) == nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ChatBox::LineQueue::setCapacity(std::size_t capacity)
+    {
+        m_capacity.store(capacity, std::memory_order_relaxed);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ChatBox::LineQueue::trim(std::size_t capacity)
+    {
+        // Only one thread at a time takes lines out of the list, if one already does then there is no need to trim
+        if (m_busy.exchange(true, std::memory_order_acquire))
+            return;
+
+        // Keep the newest lines, which are at the front of the list
+        QueuedLine* const kept = m_head.exchange(nullptr, std::memory_order_acquire);
+        QueuedLine* node = kept;
+        for (std::size_t i = 1; node && (i < capacity); ++i)
+            node = node->next;
+
+        std::size_t removedLines = 0;
+        if (node)
+        {
+            QueuedLine* removed = node->next;
+            node->next = nullptr;
+            while (removed)
+            {
+                std::unique_ptr<QueuedLine> line{removed};
+                removed = removed->next;
+                ++removedLines;
+            }
         }
+
+        m_size.fetch_sub(removedLines, std::memory_order_relaxed);
+
+        // Put the kept lines back behind the ones that were pushed in the meantime
+        QueuedLine* list = kept;
+        QueuedLine* expected = nullptr;
+        while (list && !m_head.compare_exchange_weak(expected, list, std::memory_order_release, std::memory_order_relaxed))
+        {
+            QueuedLine* newest = m_head.exchange(nullptr, std::memory_order_acquire);
+            if (newest)
+            {
+                QueuedLine* last = newest;
+                while (last->next)
+                    last = last->next;
+
+                last->next = list;
+                list = newest;
+            }
+
+            expected = nullptr;
+        }
+
+        m_busy.store(false, std::memory_order_release);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
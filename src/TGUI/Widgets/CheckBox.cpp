@@ -24,6 +24,7 @@
 
 
 #include <TGUI/Widgets/CheckBox.hpp>
+#include <TGUI/DrawBatch.hpp>
 #include <TGUI/Clipping.hpp>
 #include <SFML/Graphics/RectangleShape.hpp>
 #include <cmath>
@@ -106,6 +107,7 @@ namespace tgui
 
     void CheckBox::check()
     {
+        invalidate();
         if (!m_checked)
         {
             m_checked = true;
@@ -264,8 +266,8 @@ namespace tgui
                 // Set the clipping for all draw calls that happen until this clipping object goes out of scope
                 const Clipping clipping{target, states, {}, size};
 
-                target.draw(left, states);
-                target.draw(right, states);
+                DrawBatch::draw(target, left, states);
+                DrawBatch::draw(target, right, states);
             }
         }
         states.transform.translate({-m_bordersCached.getLeft(), -m_bordersCached.getTop()});
@@ -225,6 +225,7 @@ namespace tgui
 
     void ChildWindow::setTitle(const sf::String& title)
     {
+        invalidate();
         m_titleText.setString(title);
 
         // Reposition the images and text
@@ -242,6 +243,7 @@ namespace tgui
 
     void ChildWindow::setTitleAlignment(TitleAlignment alignment)
     {
+        invalidate();
         m_titleAlignment = alignment;
 
         // Reposition the images and text
@@ -445,6 +447,7 @@ namespace tgui
                 if (button && button->mouseOnWidget(pos))
                 {
                     button->leftMouseReleased(pos);
+                    invalidate();
                     break;
                 }
             }
@@ -455,9 +458,9 @@ namespace tgui
             if ((sf::FloatRect{0, 0, getSize().x + m_bordersCached.getLeft() + m_bordersCached.getRight(), getSize().y + m_bordersCached.getTop() + m_bordersCached.getBottom() + m_titleBarHeightCached}.contains(pos))
              && (!sf::FloatRect{m_bordersCached.getLeft(), m_titleBarHeightCached + m_bordersCached.getTop(), getSize().x, getSize().y}.contains(pos)))
             {
-                // Tell the widgets that the mouse was released
-                for (auto& widget : m_widgets)
-                    widget->mouseNoLongerDown();
+                // Tell the widget on which the mouse went down that the mouse was released
+                if (m_widgetWithLeftMouseDown)
+                    m_widgetWithLeftMouseDown->mouseNoLongerDown();
             }
             else // Propagate the event to the child widgets
                 Container::leftMouseReleased(pos + getPosition());
@@ -513,17 +516,27 @@ namespace tgui
         else if (sf::FloatRect{0, 0, getSize().x + m_bordersCached.getLeft() + m_bordersCached.getRight(), m_titleBarHeightCached}.contains(pos))
         {
             // Send the hover event to the button inside the title bar
+            bool mouseOnTitleButton = false;
             for (auto& button : {m_closeButton, m_maximizeButton, m_minimizeButton})
             {
                 if (button)
                 {
                     if (button->mouseOnWidget(pos))
+                    {
                         button->mouseMoved(pos);
+                        mouseOnTitleButton = true;
+                    }
                     else
                         button->mouseNoLongerOnWidget();
                 }
             }
 
+            // The title buttons have no parent to invalidate, so the window is redrawn while they may change
+            if (mouseOnTitleButton || m_mouseOnTitleButton)
+                invalidate();
+
+            m_mouseOnTitleButton = mouseOnTitleButton;
+
             if (!m_mouseHover)
                 mouseEnteredWidget();
 
@@ -538,6 +551,12 @@ namespace tgui
                     button->mouseNoLongerOnWidget();
             }
 
+            if (m_mouseOnTitleButton)
+            {
+                m_mouseOnTitleButton = false;
+                invalidate();
+            }
+
             // Check if the mouse is on top of the borders
             if ((sf::FloatRect{0, 0, getSize().x + m_bordersCached.getLeft() + m_bordersCached.getRight(), getSize().y + m_bordersCached.getTop() + m_bordersCached.getBottom() + m_titleBarHeightCached}.contains(pos))
              && (!sf::FloatRect{m_bordersCached.getLeft(), m_titleBarHeightCached + m_bordersCached.getTop(), getSize().x, getSize().y}.contains(pos)))
@@ -564,6 +583,12 @@ namespace tgui
             if (button)
                 button->mouseNoLongerOnWidget();
         }
+
+        if (m_mouseOnTitleButton)
+        {
+            m_mouseOnTitleButton = false;
+            invalidate();
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -583,6 +608,7 @@ namespace tgui
 
     void ChildWindow::updateTitleBarHeight()
     {
+        invalidate();
         m_spriteTitleBar.setSize({getSize().x + m_bordersCached.getLeft() + m_bordersCached.getRight(), m_titleBarHeightCached});
 
         // Set the size of the buttons in the title bar
@@ -67,6 +67,8 @@ namespace tgui
     void ClickableWidget::leftMousePressed(sf::Vector2f pos)
     {
         m_mouseDown = true; /// TODO: Is there any widget for which this can't be in Widget base class?
+        invalidate();
+
         onMousePress.emit(this, pos - getPosition());
     }
 
@@ -77,7 +79,10 @@ namespace tgui
         onMouseRelease.emit(this, pos - getPosition());
 
         if (m_mouseDown)
+        {
+            invalidate();
             onClick.emit(this, pos - getPosition());
+        }
 
         m_mouseDown = false; /// TODO: Is there any widget for which this can't be in Widget base class?
     }
@@ -25,6 +25,7 @@
 
 #include <TGUI/Container.hpp>
 #include <TGUI/Widgets/ComboBox.hpp>
+#include <TGUI/DrawBatch.hpp>
 #include <TGUI/Clipping.hpp>
 #include <SFML/Graphics/ConvexShape.hpp>
 
@@ -274,6 +275,7 @@ namespace tgui
 
     bool ComboBox::setSelectedItemByIndex(std::size_t index)
     {
+        invalidate();
         const bool ret = m_listBox->setSelectedItemByIndex(index);
         m_text.setString(m_listBox->getSelectedItem());
         return ret;
@@ -283,6 +285,7 @@ namespace tgui
 
     void ComboBox::deselectItem()
     {
+        invalidate();
         m_text.setString("");
         m_listBox->deselectItem();
     }
@@ -393,6 +396,7 @@ namespace tgui
 
     bool ComboBox::changeItemByIndex(std::size_t index, const sf::String& newValue)
     {
+        invalidate();
         const bool ret = m_listBox->changeItemByIndex(index, newValue);
         m_text.setString(m_listBox->getSelectedItem());
         return ret;
@@ -430,6 +434,7 @@ namespace tgui
 
     void ComboBox::setTextSize(unsigned int textSize)
     {
+        invalidate();
         m_listBox->setTextSize(textSize);
         m_text.setCharacterSize(m_listBox->getTextSize());
     }
@@ -644,6 +649,7 @@ namespace tgui
     {
         if (!m_listBox->isVisible() && getParent())
         {
+            invalidate();
             m_listBox->show();
 
             // Find the GuiContainer that contains the combo box
@@ -664,6 +670,7 @@ namespace tgui
         // If the list was open then close it now
         if (m_listBox->isVisible())
         {
+            invalidate();
             m_listBox->hide();
             m_listBox->mouseNoLongerOnWidget();
 
@@ -684,6 +691,7 @@ namespace tgui
         m_listBox->hide();
 
         m_listBox->onItemSelect.connect([this](){
+                                            invalidate();
                                             m_text.setString(m_listBox->getSelectedItem());
                                             onItemSelect.emit(this, m_listBox->getSelectedItem(), m_listBox->getSelectedItemId());
                                         });
@@ -772,7 +780,7 @@ namespace tgui
             else
                 arrow.setFillColor(m_arrowColorCached);
 
-            target.draw(arrow, states);
+            DrawBatch::draw(target, arrow, states);
         }
 
         // Draw the selected item
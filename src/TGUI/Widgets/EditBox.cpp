@@ -27,6 +27,10 @@
 #include <TGUI/Widgets/EditBox.hpp>
 #include <TGUI/Clipboard.hpp>
 #include <TGUI/Clipping.hpp>
+#include <TGUI/FontMetrics.hpp>
+
+#include <algorithm>
+#include <cassert>
 
 /// TODO: Where m_selStart and m_selEnd are compared, use std::min and std::max and merge the if and else bodies
 
@@ -147,15 +151,14 @@ namespace tgui
         // Check if the text is auto sized
         if (m_textSize == 0)
         {
-            m_textFull.setCharacterSize(Text::findBestTextSize(m_fontCached, (getInnerSize().y - m_paddingCached.getBottom() - m_paddingCached.getTop()) * 0.8f));
-            m_textBeforeSelection.setCharacterSize(m_textFull.getCharacterSize());
-            m_textSelection.setCharacterSize(m_textFull.getCharacterSize());
-            m_textAfterSelection.setCharacterSize(m_textFull.getCharacterSize());
-            m_defaultText.setCharacterSize(m_textFull.getCharacterSize());
+            const unsigned int textSize = Text::findBestTextSize(m_fontCached, (getInnerSize().y - m_paddingCached.getBottom() - m_paddingCached.getTop()) * 0.8f);
+            m_textBeforeSelection.setCharacterSize(textSize);
+            m_textSelection.setCharacterSize(textSize);
+            m_textAfterSelection.setCharacterSize(textSize);
+            m_defaultText.setCharacterSize(textSize);
         }
         else // When the text has a fixed size
         {
-            m_textFull.setCharacterSize(m_textSize);
             m_textBeforeSelection.setCharacterSize(m_textSize);
             m_textSelection.setCharacterSize(m_textSize);
             m_textAfterSelection.setCharacterSize(m_textSize);
@@ -163,32 +166,24 @@ namespace tgui
         }
 
         // Change the text if allowed
-        if (m_regexString == ".*")
-            m_text = text;
-        else if (std::regex_match(text.toAnsiString(), m_regex))
-            m_text = text.toAnsiString(); // Unicode is not supported when using regex because it can't be checked
-        else // Clear the text
+        if (!m_validator.match(text)) // Clear the text
             m_text = "";
+        else if (m_validator.isIncremental())
+            m_text = text;
+        else
+            m_text = text.toAnsiString(); // Unicode is not supported when falling back to std::regex because it can't be checked
 
         // Remove all the excess characters if there is a character limit
         if ((m_maxChars > 0) && (m_text.getSize() > m_maxChars))
             m_text.erase(m_maxChars, sf::String::InvalidPos);
 
         // Set the displayed text
+        m_displayedText = m_text;
         if (m_passwordChar != '\0')
-        {
-            sf::String displayedText = m_text;
-            std::fill(displayedText.begin(), displayedText.end(), m_passwordChar);
+            std::fill(m_displayedText.begin(), m_displayedText.end(), m_passwordChar);
 
-            m_textFull.setString(displayedText);
-        }
-        else
-            m_textFull.setString(m_text);
-
-        // Set the texts
-        m_textBeforeSelection.setString(m_textFull.getString());
-        m_textSelection.setString("");
-        m_textAfterSelection.setString("");
+        recalculateCharPositions();
+        updateValidatorStates(0);
 
         if (!m_fontCached)
             return;
@@ -197,34 +192,18 @@ namespace tgui
         const float width = getVisibleEditBoxWidth();
         if (m_limitTextWidth)
         {
-            // Now check if the text fits into the EditBox
-            while (m_textFull.getSize().x > width)
+            // The characters that don't fit inside the EditBox must be deleted
+            if (getFullTextWidth() > width)
             {
-                // The text doesn't fit inside the EditBox, so the last character must be deleted.
-                sf::String displayedString = m_textFull.getString();
-                displayedString.erase(displayedString.getSize()-1);
-                m_textFull.setString(displayedString);
-                m_text.erase(m_text.getSize()-1);
+                const std::size_t fittingChars = std::upper_bound(m_charPositions.begin(), m_charPositions.end(), width) - m_charPositions.begin() - 1;
+                eraseCharacters(fittingChars, m_displayedText.getSize() - fittingChars);
             }
-
-            m_textBeforeSelection.setString(m_textFull.getString());
         }
         else // There is no text cropping
-        {
-            const float textWidth = m_textFull.getSize().x;
-
-            // If the text can be moved to the right then do so
-            if (textWidth > width)
-            {
-                if (textWidth - m_textCropPosition < width)
-                    m_textCropPosition = static_cast<unsigned int>(textWidth - width);
-            }
-            else
-                m_textCropPosition = 0;
-        }
+            updateTextCropPosition();
 
         // Set the caret behind the last character
-        setCaretPosition(m_textFull.getString().getSize());
+        setCaretPosition(m_displayedText.getSize());
 
         onTextChange.emit(this, m_text);
     }
@@ -240,6 +219,7 @@ namespace tgui
 
     void EditBox::setDefaultText(const sf::String& text)
     {
+        invalidate();
         m_defaultText.setString(text);
     }
 
@@ -258,10 +238,6 @@ namespace tgui
         m_selEnd = std::min(m_text.getSize(), start + length);
         m_selChars = m_selEnd - m_selStart;
 
-        m_textBeforeSelection.setString(m_textFull.getString().substring(0, m_selStart));
-        m_textSelection.setString(m_textFull.getString().substring(m_selStart, m_selEnd - m_selStart));
-        m_textAfterSelection.setString(m_textFull.getString().substring(m_selEnd));
-
         recalculateTextPositions();
     }
 
@@ -276,6 +252,8 @@ namespace tgui
 
     void EditBox::setTextSize(unsigned int size)
     {
+        invalidate();
+
         // Change the text size
         m_textSize = size;
 
@@ -287,13 +265,15 @@ namespace tgui
 
     unsigned int EditBox::getTextSize() const
     {
-        return m_textFull.getCharacterSize();
+        return m_textBeforeSelection.getCharacterSize();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void EditBox::setPasswordCharacter(char passwordChar)
     {
+        invalidate();
+
         // Change the password character
         m_passwordChar = passwordChar;
 
@@ -316,22 +296,13 @@ namespace tgui
         m_maxChars = maxChars;
 
         // If there is a character limit then check if it is exceeded
-        if ((m_maxChars > 0) && (m_textFull.getString().getSize() > m_maxChars))
+        if ((m_maxChars > 0) && (m_displayedText.getSize() > m_maxChars))
         {
-            sf::String displayedText = m_textFull.getString();
-
             // Remove all the excess characters
-            m_text.erase(m_maxChars, sf::String::InvalidPos);
-            displayedText.erase(m_maxChars, sf::String::InvalidPos);
-
-            // If we passed here then the text has changed.
-            m_textBeforeSelection.setString(displayedText);
-            m_textSelection.setString("");
-            m_textAfterSelection.setString("");
-            m_textFull.setString(displayedText);
+            eraseCharacters(m_maxChars, m_displayedText.getSize() - m_maxChars);
 
             // Set the caret behind the last character
-            setCaretPosition(displayedText.getSize());
+            setCaretPosition(m_displayedText.getSize());
         }
     }
 
@@ -346,6 +317,7 @@ namespace tgui
 
     void EditBox::setAlignment(Alignment alignment)
     {
+        invalidate();
         m_textAlignment = alignment;
         setText(m_text);
     }
@@ -371,22 +343,17 @@ namespace tgui
         {
             // Delete the last characters when the text no longer fits inside the edit box
             const float width = getVisibleEditBoxWidth();
-            while (m_textFull.getSize().x > width)
+            if (getFullTextWidth() > width)
             {
-                sf::String displayedString = m_textFull.getString();
-                displayedString.erase(displayedString.getSize()-1);
-                m_textFull.setString(displayedString);
-                m_text.erase(m_text.getSize()-1);
+                const std::size_t fittingChars = std::upper_bound(m_charPositions.begin(), m_charPositions.end(), width) - m_charPositions.begin() - 1;
+                eraseCharacters(fittingChars, m_displayedText.getSize() - fittingChars);
             }
 
-            m_textBeforeSelection.setString(m_textFull.getString());
-
             // There is no clipping
             m_textCropPosition = 0;
 
-            // If the caret was behind the limit, then set it at the end
-            if (m_selEnd > m_textFull.getString().getSize())
-                setCaretPosition(m_selEnd);
+            // Place the caret again, it will be moved to the end when it was behind the limit
+            setCaretPosition(m_selEnd);
         }
     }
 
@@ -424,11 +391,6 @@ namespace tgui
         m_selStart = charactersBeforeCaret;
         m_selEnd = charactersBeforeCaret;
 
-        // Change our texts
-        m_textBeforeSelection.setString(m_textFull.getString());
-        m_textSelection.setString("");
-        m_textAfterSelection.setString("");
-
         if (!m_fontCached)
             return;
 
@@ -436,7 +398,7 @@ namespace tgui
         if (!m_limitTextWidth)
         {
             // Find out the position of the caret
-            const float caretPosition = m_textFull.findCharacterPos(m_selEnd).x;
+            const float caretPosition = m_charPositions[m_selEnd];
 
             // If the caret is too far on the right then adjust the cropping
             if (m_textCropPosition + getVisibleEditBoxWidth() < caretPosition)
@@ -461,8 +423,8 @@ namespace tgui
 
     void EditBox::setInputValidator(const std::string& regex)
     {
-        m_regexString = regex;
-        m_regex = m_regexString;
+        m_validator = InputValidator{regex};
+        m_validatorStates.clear();
 
         setText(m_text);
     }
@@ -471,7 +433,7 @@ namespace tgui
 
     const std::string& EditBox::getInputValidator() const
     {
-        return m_regexString;
+        return m_validator.getPattern();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -490,7 +452,7 @@ namespace tgui
             --caretPosition;
 
         // When clicking on the right of the right character, move the caret to the right
-        else if ((positionX > getVisibleEditBoxWidth()) && (caretPosition < m_textFull.getString().getSize()))
+        else if ((positionX > getVisibleEditBoxWidth()) && (caretPosition < m_displayedText.getSize()))
             ++caretPosition;
 
         // Check if this is a double click
@@ -500,17 +462,12 @@ namespace tgui
             m_possibleDoubleClick = false;
 
             // Set the caret at the end of the text
-            setCaretPosition(m_textFull.getString().getSize());
+            setCaretPosition(m_displayedText.getSize());
 
             // Select the whole text
             m_selStart = 0;
             m_selEnd = m_text.getSize();
             m_selChars = m_text.getSize();
-
-            // Change the texts
-            m_textBeforeSelection.setString("");
-            m_textSelection.setString(m_textFull.getString());
-            m_textAfterSelection.setString("");
         }
         else // No double clicking
         {
@@ -556,15 +513,16 @@ namespace tgui
             else // Scrolling is enabled
             {
                 const float width = getVisibleEditBoxWidth();
+                const unsigned int oldTextCropPosition = m_textCropPosition;
 
                 // Check if the mouse is on the left of the text
                 if (pos.x < m_bordersCached.getLeft() + m_paddingCached.getLeft())
                 {
                     // Move the text by a few pixels
-                    if (m_textFull.getCharacterSize() > 10)
+                    if (getTextSize() > 10)
                     {
-                        if (m_textCropPosition > m_textFull.getCharacterSize() / 10)
-                            m_textCropPosition -= static_cast<unsigned int>(m_textFull.getCharacterSize() / 10.f);
+                        if (m_textCropPosition > getTextSize() / 10)
+                            m_textCropPosition -= static_cast<unsigned int>(getTextSize() / 10.f);
                         else
                             m_textCropPosition = 0;
                     }
@@ -575,23 +533,27 @@ namespace tgui
                     }
                 }
                 // Check if the mouse is on the right of the text AND there is a possibility to scroll
-                else if ((pos.x > m_bordersCached.getLeft() + m_paddingCached.getLeft() + width) && (m_textFull.getSize().x > width))
+                else if ((pos.x > m_bordersCached.getLeft() + m_paddingCached.getLeft() + width) && (getFullTextWidth() > width))
                 {
                     // Move the text by a few pixels
-                    if (m_textFull.getCharacterSize() > 10)
+                    if (getTextSize() > 10)
                     {
-                        if (m_textCropPosition + width < m_textFull.getSize().x + (m_textFull.getCharacterSize() / 10))
-                            m_textCropPosition += static_cast<unsigned int>(m_textFull.getCharacterSize() / 10.f);
+                        if (m_textCropPosition + width < getFullTextWidth() + (getTextSize() / 10))
+                            m_textCropPosition += static_cast<unsigned int>(getTextSize() / 10.f);
                         else
-                            m_textCropPosition = static_cast<unsigned int>(m_textFull.getSize().x + (m_textFull.getCharacterSize() / 10) - width);
+                            m_textCropPosition = static_cast<unsigned int>(getFullTextWidth() + (getTextSize() / 10) - width);
                     }
                     else
                     {
-                        if (m_textCropPosition + width < m_textFull.getSize().x)
+                        if (m_textCropPosition + width < getFullTextWidth())
                             ++m_textCropPosition;
                     }
                 }
 
+                // The text has moved even if the selection doesn't change
+                if (m_textCropPosition != oldTextCropPosition)
+                    invalidate();
+
                 // Find out between which characters the mouse is standing
                 m_selEnd = findCaretPosition(pos.x - m_bordersCached.getLeft() - m_paddingCached.getLeft());
             }
@@ -605,11 +567,6 @@ namespace tgui
                     // Adjust the number of characters that are selected
                     m_selChars = m_selEnd - m_selStart;
 
-                    // Change our three texts
-                    m_textBeforeSelection.setString(m_textFull.getString().substring(0, m_selStart));
-                    m_textSelection.setString(m_textFull.getString().substring(m_selStart, m_selChars));
-                    m_textAfterSelection.setString(m_textFull.getString().substring(m_selEnd));
-
                     recalculateTextPositions();
                 }
             }
@@ -621,11 +578,6 @@ namespace tgui
                     // Adjust the number of characters that are selected
                     m_selChars = m_selStart - m_selEnd;
 
-                    // Change our three texts
-                    m_textBeforeSelection.setString(m_textFull.getString().substring(0, m_selEnd));
-                    m_textSelection.setString(m_textFull.getString().substring(m_selEnd, m_selChars));
-                    m_textAfterSelection.setString(m_textFull.getString().substring(m_selStart));
-
                     recalculateTextPositions();
                 }
             }
@@ -634,11 +586,6 @@ namespace tgui
                 // Adjust the number of characters that are selected
                 m_selChars = 0;
 
-                // Change our three texts
-                m_textBeforeSelection.setString(m_textFull.getString());
-                m_textSelection.setString("");
-                m_textAfterSelection.setString("");
-
                 recalculateTextPositions();
             }
         }
@@ -679,7 +626,7 @@ namespace tgui
             else // When we did not select any text
             {
                 // Move the caret to the right
-                if (m_selEnd < m_textFull.getString().getSize())
+                if (m_selEnd < m_displayedText.getSize())
                     setCaretPosition(m_selEnd + 1);
             }
 
@@ -722,27 +669,13 @@ namespace tgui
                     return;
 
                 // Erase the character
-                sf::String displayedString = m_textFull.getString();
-                displayedString.erase(m_selEnd-1, 1);
-                m_textFull.setString(displayedString);
-                m_text.erase(m_selEnd-1, 1);
+                eraseCharacters(m_selEnd - 1, 1);
+
+                // If the text can be moved to the right then do so
+                updateTextCropPosition();
 
                 // Set the caret back on the correct position
                 setCaretPosition(m_selEnd - 1);
-
-                const float width = getVisibleEditBoxWidth();
-
-                // Calculate the text width
-                const float textWidth = m_textFull.getSize().x;
-
-                // If the text can be moved to the right then do so
-                if (textWidth > width)
-                {
-                    if (textWidth - m_textCropPosition < width)
-                        m_textCropPosition = static_cast<unsigned int>(textWidth - width);
-                }
-                else
-                    m_textCropPosition = 0;
             }
             else // When you did select some characters, delete them
                 deleteSelectedCharacters();
@@ -766,26 +699,13 @@ namespace tgui
                     return;
 
                 // Erase the character
-                sf::String displayedString = m_textFull.getString();
-                displayedString.erase(m_selEnd, 1);
-                m_textFull.setString(displayedString);
-                m_text.erase(m_selEnd, 1);
+                eraseCharacters(m_selEnd, 1);
+
+                // If the text can be moved to the right then do so
+                updateTextCropPosition();
 
                 // Set the caret back on the correct position
                 setCaretPosition(m_selEnd);
-
-                // Calculate the text width
-                const float textWidth = m_textFull.getSize().x;
-
-                // If the text can be moved to the right then do so
-                const float width = getVisibleEditBoxWidth();
-                if (textWidth > width)
-                {
-                    if (textWidth - m_textCropPosition < width)
-                        m_textCropPosition = static_cast<unsigned int>(textWidth - width);
-                }
-                else
-                    m_textCropPosition = 0;
             }
             else // You did select some characters, delete them
                 deleteSelectedCharacters();
@@ -803,7 +723,7 @@ namespace tgui
             {
                 if (event.code == sf::Keyboard::C)
                 {
-                    Clipboard::set(m_textSelection.getString());
+                    Clipboard::set(m_displayedText.substring(std::min(m_selStart, m_selEnd), m_selChars));
                 }
                 else if (event.code == sf::Keyboard::V)
                 {
@@ -815,21 +735,22 @@ namespace tgui
                     // Only continue pasting if you actually have to do something
                     if ((m_selChars > 0) || (clipboardContents.getSize() > 0))
                     {
+                        const bool textSelected = (m_selChars > 0);
                         deleteSelectedCharacters();
 
-                        const std::size_t oldCaretPos = m_selEnd;
-
-                        if (m_text.getSize() > m_selEnd)
-                            setText(m_text.toWideString().substr(0, m_selEnd) + Clipboard::get() + m_text.toWideString().substr(m_selEnd, m_text.getSize() - m_selEnd));
-                        else
-                            setText(m_text + clipboardContents);
+                        if (pasteCharacters(clipboardContents) || textSelected)
+                        {
+                            // The caret should be visible again
+                            m_caretVisible = true;
+                            m_animationTimeElapsed = {};
 
-                        setCaretPosition(oldCaretPos + clipboardContents.getSize());
+                            onTextChange.emit(this, m_text);
+                        }
                     }
                 }
                 else if (event.code == sf::Keyboard::X)
                 {
-                    Clipboard::set(m_textSelection.getString());
+                    Clipboard::set(m_displayedText.substring(std::min(m_selStart, m_selEnd), m_selChars));
 
                     if (m_readOnly)
                         return;
@@ -854,15 +775,8 @@ namespace tgui
             return;
 
         // Only add the character when the regex matches
-        if (m_regexString != ".*")
-        {
-            sf::String text = m_text;
-            text.insert(m_selEnd, key);
-
-            // The character has to match the regex
-            if (!std::regex_match(text.toAnsiString(), m_regex))
-                return;
-        }
+        if (!isValidInsertion(m_selEnd, key))
+            return;
 
         // If there are selected characters then delete them first
         if (m_selChars > 0)
@@ -873,27 +787,16 @@ namespace tgui
             return;
 
         // Insert our character
-        m_text.insert(m_selEnd, key);
-
-        // Change the displayed text
-        sf::String displayedText = m_textFull.getString();
-        if (m_passwordChar != '\0')
-            displayedText.insert(m_selEnd, m_passwordChar);
-        else
-            displayedText.insert(m_selEnd, key);
-
-        m_textFull.setString(displayedText);
+        insertCharacters(m_selEnd, key);
 
         // When there is a text width limit then reverse what we just did
         if (m_limitTextWidth)
         {
             // Now check if the text fits into the EditBox
-            if (m_textFull.getSize().x > getVisibleEditBoxWidth())
+            if (getFullTextWidth() > getVisibleEditBoxWidth())
             {
                 // If the text does not fit in the EditBox then delete the added character
-                m_text.erase(m_selEnd, 1);
-                displayedText.erase(m_selEnd, 1);
-                m_textFull.setString(displayedText);
+                eraseCharacters(m_selEnd, 1);
                 return;
             }
         }
@@ -1013,7 +916,11 @@ namespace tgui
             m_textBeforeSelection.setStyle(style);
             m_textAfterSelection.setStyle(style);
             m_textSelection.setStyle(style);
-            m_textFull.setStyle(style);
+
+            // Bold text has wider characters
+            recalculateCharPositions();
+            updateTextCropPosition();
+            setCaretPosition(m_selEnd);
         }
         else if (property == "defaulttextstyle")
         {
@@ -1080,7 +987,6 @@ namespace tgui
             m_textBeforeSelection.setFont(m_fontCached);
             m_textSelection.setFont(m_fontCached);
             m_textAfterSelection.setFont(m_fontCached);
-            m_textFull.setFont(m_fontCached);
             m_defaultText.setFont(m_fontCached);
 
             // Recalculate the text size and position
@@ -1116,7 +1022,7 @@ namespace tgui
         if (m_textAlignment != Alignment::Left)
         {
             const float editBoxWidth = getVisibleEditBoxWidth();
-            const float textWidth = m_textFull.getSize().x;
+            const float textWidth = getFullTextWidth();
 
             if (textWidth < editBoxWidth)
             {
@@ -1128,44 +1034,244 @@ namespace tgui
             }
         }
 
-        float width = 0;
-        sf::Uint32 prevChar = 0;
-        const unsigned int textSize = getTextSize();
-        const bool bold = (m_textFull.getStyle() & sf::Text::Bold) != 0;
+        if (m_fontCached == nullptr)
+            return 0;
+
+        // Find the first character that ends behind the position
+        const auto it = std::lower_bound(m_charPositions.begin() + 1, m_charPositions.end(), posX);
+        if (it == m_charPositions.end())
+            return m_displayedText.getSize();
+
+        // If the mouse is on the second halve of the character then the caret should be on the right of it
+        const std::size_t index = static_cast<std::size_t>(it - m_charPositions.begin()) - 1;
+        if (posX - m_charPositions[index] > (m_charPositions[index + 1] - m_charPositions[index]) / 2.f)
+            return index + 1;
+        else
+            return index;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    float EditBox::getFullTextWidth() const
+    {
+        return m_charPositions.back();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void EditBox::recalculateCharPositions()
+    {
+        // Measure the whole text as if it was inserted into an empty string
+        m_charPositions.assign(1, 0);
+        updateCharPositions(0, 0, m_displayedText.getSize());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void EditBox::updateCharPositions(std::size_t pos, std::size_t erasedChars, std::size_t insertedChars)
+    {
+        const std::size_t length = m_displayedText.getSize();
+        assert(m_charPositions.size() == length + erasedChars - insertedChars + 1);
 
-        std::size_t index;
-        for (index = 0; index < m_text.getSize(); ++index)
+        // The character behind the changed part keeps its width, but its kerning may have changed
+        const std::size_t nextChar = pos + insertedChars;
+        const float oldNextCharEnd = (nextChar < length) ? m_charPositions[pos + erasedChars + 1] : 0;
+
+        if (erasedChars > insertedChars)
+            m_charPositions.erase(m_charPositions.begin() + pos + 1, m_charPositions.begin() + pos + 1 + (erasedChars - insertedChars));
+        else if (insertedChars > erasedChars)
+            m_charPositions.insert(m_charPositions.begin() + pos + 1, insertedChars - erasedChars, 0.f);
+
+        // Measure the inserted characters and the one behind them
+        const std::size_t lastMeasuredChar = std::min(nextChar + 1, length);
+        if (m_fontCached)
         {
-            float charWidth;
-            sf::Uint32 curChar = m_text[index];
-            if (curChar == '\n')
+            const bool bold = (m_textBeforeSelection.getStyle() & sf::Text::Bold) != 0;
+            const FontMetrics& metrics = FontMetrics::get(m_fontCached, getTextSize(), bold);
+            for (std::size_t i = pos; i < lastMeasuredChar; ++i)
             {
-                // This should not happen as edit box is for single line text, but lets try the next line anyway since we haven't found the position yet
-                width = 0;
-                prevChar = 0;
-                continue;
+                const sf::Uint32 prevChar = (i > 0) ? m_displayedText[i - 1] : 0;
+                const sf::Uint32 curChar = m_displayedText[i];
+
+                float charWidth;
+                if (curChar == '\n') // This should not happen as edit box is for single line text
+                    charWidth = 0;
+                else if (curChar == '\t')
+                    charWidth = metrics.getAdvance(' ') * 4;
+                else
+                    charWidth = metrics.getAdvance(curChar);
+
+                m_charPositions[i + 1] = m_charPositions[i] + metrics.getKerning(prevChar, curChar) + charWidth;
             }
-            else if (curChar == '\t')
-                charWidth = static_cast<float>(m_fontCached.getGlyph(' ', textSize, bold).advance) * 4;
-            else
-                charWidth = static_cast<float>(m_fontCached.getGlyph(curChar, textSize, bold).advance);
+        }
+        else
+            std::fill(m_charPositions.begin() + pos + 1, m_charPositions.begin() + lastMeasuredChar + 1, 0.f);
 
-            const float kerning = static_cast<float>(m_fontCached.getKerning(prevChar, curChar, textSize));
-            if (width + charWidth < posX)
-                width += charWidth + kerning;
-            else
+        // All characters behind it are moved by the same distance
+        if (nextChar < length)
+        {
+            const float offset = m_charPositions[nextChar + 1] - oldNextCharEnd;
+            for (std::size_t i = nextChar + 2; i <= length; ++i)
+                m_charPositions[i] += offset;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void EditBox::insertCharacters(std::size_t pos, const sf::String& text)
+    {
+        m_text.insert(pos, text);
+
+        if (m_passwordChar != '\0')
+        {
+            sf::String displayedText = text;
+            std::fill(displayedText.begin(), displayedText.end(), m_passwordChar);
+            m_displayedText.insert(pos, displayedText);
+        }
+        else
+            m_displayedText.insert(pos, text);
+
+        updateCharPositions(pos, 0, text.getSize());
+        updateValidatorStates(pos);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void EditBox::eraseCharacters(std::size_t pos, std::size_t count)
+    {
+        m_text.erase(pos, count);
+        m_displayedText.erase(pos, count);
+
+        updateCharPositions(pos, count, 0);
+        updateValidatorStates(pos);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool EditBox::isValidInsertion(std::size_t pos, const sf::String& text) const
+    {
+        if (m_validator.getPattern() == ".*")
+            return true;
+
+        if (m_validator.isIncremental())
+        {
+            // Continue from the state in front of the inserted characters, only the characters behind it have to be checked
+            // again. When typing at the end of the text, this only checks the new characters.
+            InputValidator::State state = m_validatorStates[pos];
+            for (const sf::Uint32 character : text)
+                state = m_validator.advance(state, character);
+            for (std::size_t i = pos; i < m_text.getSize(); ++i)
+                state = m_validator.advance(state, m_text[i]);
+
+            return m_validator.isAccepting(state);
+        }
+        else
+        {
+            sf::String newText = m_text;
+            newText.insert(pos, text);
+            return m_validator.match(newText);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool EditBox::pasteCharacters(sf::String text)
+    {
+        // Unicode is not supported when falling back to std::regex because it can't be checked
+        if (!m_validator.isIncremental())
+            text = text.toAnsiString();
+
+        // Only paste as many characters as the character limit allows
+        if (m_maxChars > 0)
+        {
+            if (m_text.getSize() >= m_maxChars)
+                return false;
+
+            if (m_text.getSize() + text.getSize() > m_maxChars)
+                text.erase(m_maxChars - m_text.getSize(), sf::String::InvalidPos);
+        }
+
+        if (text.isEmpty() || !isValidInsertion(m_selEnd, text))
+            return false;
+
+        const std::size_t pos = m_selEnd;
+        std::size_t insertedChars = text.getSize();
+        insertCharacters(pos, text);
+
+        // When there is a text width limit then the pasted characters that don't fit are removed again
+        if (m_limitTextWidth && m_fontCached)
+        {
+            const float width = getVisibleEditBoxWidth();
+            const float fullWidth = getFullTextWidth();
+            if (fullWidth > width)
             {
-                // If the mouse is on the second halve of the character then the caret should be on the right of it
-                if (width + charWidth - posX < charWidth / 2.f)
-                    index++;
+                // Find how many characters have to be removed, kerning may require removing one more afterwards
+                const float keptEnd = m_charPositions[pos + insertedChars] - (fullWidth - width);
+                const std::size_t keptChars = std::upper_bound(m_charPositions.begin() + pos, m_charPositions.begin() + pos + insertedChars + 1, keptEnd)
+                                              - (m_charPositions.begin() + pos) - 1;
 
-                break;
+                eraseCharacters(pos + keptChars, insertedChars - keptChars);
+                insertedChars = keptChars;
+
+                while ((insertedChars > 0) && (getFullTextWidth() > width))
+                {
+                    eraseCharacters(pos + insertedChars - 1, 1);
+                    --insertedChars;
+                }
+
+                // What remains of the pasted text still has to match the regex
+                if ((insertedChars > 0) && (m_validator.getPattern() != ".*"))
+                {
+                    const bool valid = m_validator.isIncremental() ? m_validator.isAccepting(m_validatorStates.back()) : m_validator.match(m_text);
+                    if (!valid)
+                    {
+                        eraseCharacters(pos, insertedChars);
+                        insertedChars = 0;
+                    }
+                }
+
+                if (insertedChars == 0)
+                    return false;
             }
+        }
+
+        // Move the caret behind the pasted characters
+        setCaretPosition(pos + insertedChars);
+        return true;
+    }
 
-            prevChar = curChar;
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void EditBox::updateTextCropPosition()
+    {
+        const float width = getVisibleEditBoxWidth();
+        const float textWidth = getFullTextWidth();
+        if (textWidth > width)
+        {
+            if (textWidth - m_textCropPosition < width)
+                m_textCropPosition = static_cast<unsigned int>(textWidth - width);
         }
+        else
+            m_textCropPosition = 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        return index;
+    void EditBox::updateValidatorStates(std::size_t pos)
+    {
+        if (!m_validator.isIncremental())
+        {
+            m_validatorStates.clear();
+            return;
+        }
+
+        // The states in front of the changed position remain the same
+        if (m_validatorStates.empty())
+            m_validatorStates.push_back(m_validator.getStartState());
+
+        m_validatorStates.resize(std::min(pos, m_validatorStates.size() - 1) + 1);
+        for (std::size_t i = m_validatorStates.size() - 1; i < m_text.getSize(); ++i)
+            m_validatorStates.push_back(m_validator.advance(m_validatorStates.back(), m_text[i]));
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1179,38 +1285,37 @@ namespace tgui
         const std::size_t pos = std::min(m_selStart, m_selEnd);
 
         // Erase the characters
-        sf::String displayedString = m_textFull.getString();
-        displayedString.erase(pos, m_selChars);
-        m_textFull.setString(displayedString);
-        m_text.erase(pos, m_selChars);
+        eraseCharacters(pos, m_selChars);
+
+        // If the text can be moved to the right then do so
+        updateTextCropPosition();
 
         // Set the caret back on the correct position
         setCaretPosition(pos);
-
-        // If the text can be moved to the right then do so
-        const float width = getVisibleEditBoxWidth();
-        const float textWidth = m_textFull.getSize().x;
-        if (textWidth > width)
-        {
-            if (textWidth - m_textCropPosition < width)
-                m_textCropPosition = static_cast<unsigned int>(textWidth - width);
-        }
-        else
-            m_textCropPosition = 0;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void EditBox::recalculateTextPositions()
     {
+        invalidate();
+
+        const FontMetrics* metrics = nullptr;
+        float textHeight = 0;
+        if (m_fontCached)
+        {
+            metrics = &FontMetrics::get(m_fontCached, getTextSize(), (m_textBeforeSelection.getStyle() & sf::Text::Bold) != 0);
+            textHeight = metrics->getLineSpacing() + metrics->getExtraVerticalSpace();
+        }
+
         float textX = m_paddingCached.getLeft() - m_textCropPosition;
-        const float textY = m_paddingCached.getTop() + (((getInnerSize().y - m_paddingCached.getBottom() - m_paddingCached.getTop()) - m_textFull.getSize().y) / 2.f);
+        const float textY = m_paddingCached.getTop() + (((getInnerSize().y - m_paddingCached.getBottom() - m_paddingCached.getTop()) - textHeight) / 2.f);
 
         // Check if the layout wasn't left
         if (m_textAlignment != Alignment::Left)
         {
             // Calculate the text width
-            const float textWidth = m_textFull.getString().isEmpty() ? m_defaultText.getSize().x : m_textFull.getSize().x;
+            const float textWidth = m_displayedText.isEmpty() ? m_defaultText.getSize().x : getFullTextWidth();
 
             // Check if a layout would make sense
             if (textWidth < getVisibleEditBoxWidth())
@@ -1223,40 +1328,55 @@ namespace tgui
             }
         }
 
-        float caretLeft = textX;
-
-        // Set the text before the selection on the correct position
-        m_textBeforeSelection.setPosition(textX, textY);
         m_defaultText.setPosition(textX, textY);
 
-        // Check if there is a selection
+        // Find the characters that are visible inside the edit box. One extra character is included on both sides because
+        // glyphs can extend a bit outside their advance.
+        const float visibleLeft = m_paddingCached.getLeft() - textX;
+        const float visibleRight = visibleLeft + getVisibleEditBoxWidth();
+        const std::size_t firstVisibleEnd = std::upper_bound(m_charPositions.begin(), m_charPositions.end(), visibleLeft) - m_charPositions.begin();
+        const std::size_t lastVisibleStart = std::lower_bound(m_charPositions.begin(), m_charPositions.end(), visibleRight) - m_charPositions.begin();
+        const std::size_t firstChar = (firstVisibleEnd >= 2) ? firstVisibleEnd - 2 : 0;
+        const std::size_t endChar = std::max(firstChar, std::min(lastVisibleStart + 1, m_displayedText.getSize()));
+
+        // Without a selection, all visible characters are placed in the text before the selection
+        std::size_t selectionStart = m_displayedText.getSize();
+        std::size_t selectionEnd = m_displayedText.getSize();
         if (m_selChars != 0)
         {
-            // Watch out for the kerning
-            if (m_textBeforeSelection.getString().getSize() > 0)
-                textX += m_fontCached.getKerning(m_textFull.getString()[m_textBeforeSelection.getString().getSize() - 1], m_textFull.getString()[m_textBeforeSelection.getString().getSize()], m_textBeforeSelection.getCharacterSize());
-
-            textX += m_textBeforeSelection.findCharacterPos(m_textBeforeSelection.getString().getSize()).x;
+            selectionStart = std::min(m_selStart, m_selEnd);
+            selectionEnd = std::max(m_selStart, m_selEnd);
+        }
 
-            // Set the position and size of the rectangle that gets drawn behind the selected text
-            m_selectedTextBackground.setSize({m_textSelection.findCharacterPos(m_textSelection.getString().getSize()).x,
-                                              getInnerSize().y - m_paddingCached.getTop() - m_paddingCached.getBottom()});
-            m_selectedTextBackground.setPosition({textX, m_paddingCached.getTop()});
+        const std::size_t selectionVisibleStart = std::max(firstChar, std::min(selectionStart, endChar));
+        const std::size_t selectionVisibleEnd = std::max(selectionVisibleStart, std::min(selectionEnd, endChar));
+        m_textBeforeSelection.setString(m_displayedText.substring(firstChar, selectionVisibleStart - firstChar));
+        m_textSelection.setString(m_displayedText.substring(selectionVisibleStart, selectionVisibleEnd - selectionVisibleStart));
+        m_textAfterSelection.setString(m_displayedText.substring(selectionVisibleEnd, endChar - selectionVisibleEnd));
 
-            // Set the text selected text on the correct position
-            m_textSelection.setPosition(textX, textY);
+        // A text doesn't apply kerning to its first character, so it is added to the position of the text
+        const auto findTextPosition = [this,metrics](std::size_t index)
+            {
+                if (!metrics || (index == 0) || (index >= m_displayedText.getSize()))
+                    return m_charPositions[index];
+                else
+                    return m_charPositions[index] + metrics->getKerning(m_displayedText[index - 1], m_displayedText[index]);
+            };
 
-            // Watch out for kerning
-            if (m_textFull.getString().getSize() > m_textBeforeSelection.getString().getSize() + m_textSelection.getString().getSize())
-                textX += m_fontCached.getKerning(m_textFull.getString()[m_textBeforeSelection.getString().getSize() + m_textSelection.getString().getSize() - 1], m_textFull.getString()[m_textBeforeSelection.getString().getSize() + m_textSelection.getString().getSize()], m_textBeforeSelection.getCharacterSize());
+        m_textBeforeSelection.setPosition(textX + findTextPosition(firstChar), textY);
+        m_textSelection.setPosition(textX + findTextPosition(selectionVisibleStart), textY);
+        m_textAfterSelection.setPosition(textX + findTextPosition(selectionVisibleEnd), textY);
 
-            // Set the text selected text on the correct position
-            textX += m_textSelection.findCharacterPos(m_textSelection.getString().getSize()).x;
-            m_textAfterSelection.setPosition(textX, textY);
+        // Set the position and size of the rectangle that gets drawn behind the selected text
+        if (m_selChars != 0)
+        {
+            m_selectedTextBackground.setSize({m_charPositions[selectionEnd] - m_charPositions[selectionStart],
+                                              getInnerSize().y - m_paddingCached.getTop() - m_paddingCached.getBottom()});
+            m_selectedTextBackground.setPosition({textX + m_charPositions[selectionStart], m_paddingCached.getTop()});
         }
 
         // Set the position of the caret
-        caretLeft += m_textFull.findCharacterPos(m_selEnd).x - (m_caret.getSize().x * 0.5f);
+        const float caretLeft = textX + m_charPositions[m_selEnd] - (m_caret.getSize().x * 0.5f);
         m_caret.setPosition({caretLeft, m_paddingCached.getTop()});
     }
 
@@ -1275,6 +1395,10 @@ namespace tgui
             // Switch the value of the visible flag
             m_caretVisible = !m_caretVisible;
 
+            // The caret is only drawn while the widget is focused
+            if (m_focused)
+                invalidate();
+
             // Too slow for double clicking
             m_possibleDoubleClick = false;
         }
@@ -1282,6 +1406,18 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    sf::Time EditBox::timeUntilNextUpdate() const
+    {
+        const sf::Time time = Widget::timeUntilNextUpdate();
+        if (!m_focused)
+            return time;
+
+        // The caret is shown or hidden every half second
+        return std::min(time, std::max(sf::Time::Zero, sf::milliseconds(500) - m_animationTimeElapsed));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void EditBox::draw(sf::RenderTarget& target, sf::RenderStates states) const
     {
         states.transform.translate(getPosition());
@@ -1329,11 +1465,11 @@ namespace tgui
         // Set the clipping for all draw calls that happen until this clipping object goes out of scope
         const Clipping clipping{target, states, {m_paddingCached.getLeft(), m_paddingCached.getTop()}, {getInnerSize().x - m_paddingCached.getLeft() - m_paddingCached.getRight(), getInnerSize().y - m_paddingCached.getTop() - m_paddingCached.getBottom()}};
 
-        if ((m_textBeforeSelection.getString() != "") || (m_textSelection.getString() != ""))
+        if (!m_displayedText.isEmpty())
         {
             m_textBeforeSelection.draw(target, states);
 
-            if (m_textSelection.getString() != "")
+            if (m_selChars != 0)
             {
                 states.transform.translate(m_selectedTextBackground.getPosition());
                 drawRectangleShape(target, states, m_selectedTextBackground.getSize(), m_selectedTextBackgroundColorCached);
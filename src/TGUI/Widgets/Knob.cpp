@@ -24,6 +24,7 @@
 
 
 #include <TGUI/Widgets/Knob.hpp>
+#include <TGUI/DrawBatch.hpp>
 #include <SFML/Graphics/CircleShape.hpp>
 #include <cmath>
 
@@ -302,6 +303,9 @@ namespace tgui
         // Check if the mouse button is down
         if (m_mouseDown)
         {
+            // The knob points towards the mouse, even when the value doesn't change
+            invalidate();
+
             // Find out the direction that the knob should now point
             if (compareFloats(pos.x, centerPosition.x))
             {
@@ -416,6 +420,8 @@ namespace tgui
 
     void Knob::recalculateRotation()
     {
+        invalidate();
+
         // Calculate the difference in degrees between the start and end rotation
         float allowedAngle = 0;
         if (compareFloats(m_startRotation, m_endRotation))
@@ -529,7 +535,7 @@ namespace tgui
             bordersShape.setFillColor(sf::Color::Transparent);
             bordersShape.setOutlineColor(Color::calcColorOpacity(m_borderColorCached, m_opacityCached));
             bordersShape.setOutlineThickness(borderThickness);
-            target.draw(bordersShape, states);
+            DrawBatch::draw(target, bordersShape, states);
         }
 
         // Draw the background
@@ -539,7 +545,7 @@ namespace tgui
         {
             sf::CircleShape background{size / 2};
             background.setFillColor(Color::calcColorOpacity(m_backgroundColorCached, m_opacityCached));
-            target.draw(background, states);
+            DrawBatch::draw(target, background, states);
         }
 
         // Draw the foreground
@@ -561,7 +567,7 @@ namespace tgui
             thumb.setFillColor(Color::calcColorOpacity(m_thumbColorCached, m_opacityCached));
             thumb.setPosition({(size / 2.0f) - thumb.getRadius() + (std::cos(m_angle / 180 * pi) * (size / 2) * 3/5),
                                (size / 2.0f) - thumb.getRadius() + (-std::sin(m_angle / 180 * pi) * (size / 2) * 3/5)});
-            target.draw(thumb, states);
+            DrawBatch::draw(target, thumb, states);
         }
     }
 
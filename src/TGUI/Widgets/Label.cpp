@@ -300,6 +300,7 @@ namespace tgui
 
     void Label::rearrangeText()
     {
+        invalidate();
         if (m_fontCached == nullptr)
             return;
 
@@ -315,34 +316,33 @@ namespace tgui
                 return;
         }
 
-        // Fit the text in the available space
-        const sf::String string = Text::wordWrap(maxWidth, m_string, m_fontCached, m_textSize, m_textStyleCached & sf::Text::Bold);
+        // Find where the text has to be split to fit in the available space
+        const std::vector<std::size_t> lineBreaks = Text::findLineBreaks(maxWidth, m_string, m_fontCached, m_textSize, m_textStyleCached & sf::Text::Bold);
+
+        // Existing lines are reused, so that lines which didn't change keep their glyphs
+        m_lines.resize(lineBreaks.size() + 1);
 
-        // Split the string in multiple lines
-        m_lines.clear();
         float width = 0;
-        std::size_t searchPosStart = 0;
-        std::size_t newLinePos = 0;
-        while (newLinePos != sf::String::InvalidPos)
+        std::size_t lineStart = 0;
+        for (std::size_t i = 0; i < m_lines.size(); ++i)
         {
-            newLinePos = string.find('\n', searchPosStart);
-
-            m_lines.emplace_back();
-            m_lines.back().setCharacterSize(getTextSize());
-            m_lines.back().setFont(m_fontCached);
-            m_lines.back().setStyle(m_textStyleCached);
-            m_lines.back().setColor(m_textColorCached);
-            m_lines.back().setOpacity(m_opacityCached);
-
-            if (newLinePos != sf::String::InvalidPos)
-                m_lines.back().setString(string.substring(searchPosStart, newLinePos - searchPosStart));
-            else
-                m_lines.back().setString(string.substring(searchPosStart));
-
-            if (m_lines.back().getSize().x > width)
-                width = m_lines.back().getSize().x;
-
-            searchPosStart = newLinePos + 1;
+            std::size_t lineEnd = (i < lineBreaks.size()) ? lineBreaks[i] : m_string.getSize();
+            const std::size_t nextLineStart = lineEnd;
+            if ((lineEnd > lineStart) && (m_string[lineEnd - 1] == '\n'))
+                lineEnd--;
+
+            Text& line = m_lines[i];
+            line.setCharacterSize(getTextSize());
+            line.setFont(m_fontCached);
+            line.setStyle(m_textStyleCached);
+            line.setColor(m_textColorCached);
+            line.setOpacity(m_opacityCached);
+            line.setString(m_string.substring(lineStart, lineEnd - lineStart));
+
+            if (line.getSize().x > width)
+                width = line.getSize().x;
+
+            lineStart = nextLineStart;
         }
 
         const Outline outline = {m_paddingCached.getLeft() + m_bordersCached.getLeft(),
@@ -109,6 +109,8 @@ namespace tgui
 
     bool ListBox::addItem(const sf::String& itemName, const sf::String& id)
     {
+        invalidate();
+
         // Check if the item limit is reached (if there is one)
         if ((m_maxItems == 0) || (m_items.size() < m_maxItems))
         {
@@ -326,6 +328,7 @@ namespace tgui
 
     bool ListBox::changeItemByIndex(std::size_t index, const sf::String& newValue)
     {
+        invalidate();
         if (index >= m_items.size())
             return false;
 
@@ -362,6 +365,8 @@ namespace tgui
 
     void ListBox::setItemHeight(unsigned int itemHeight)
     {
+        invalidate();
+
         // Set the new heights
         m_itemHeight = itemHeight;
         if (m_requestedTextSize == 0)
@@ -387,6 +392,7 @@ namespace tgui
 
     void ListBox::setTextSize(unsigned int textSize)
     {
+        invalidate();
         m_requestedTextSize = textSize;
 
         if (textSize)
@@ -411,6 +417,8 @@ namespace tgui
 
     void ListBox::setMaximumItems(std::size_t maximumItems)
     {
+        invalidate();
+
         // Set the new limit
         m_maxItems = maximumItems;
 
@@ -490,6 +498,9 @@ namespace tgui
                 }
             }
         }
+
+        if (m_scroll.wasInvalidated())
+            invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -517,6 +528,9 @@ namespace tgui
         }
 
         m_scroll.leftMouseReleased(pos - getPosition());
+
+        if (m_scroll.wasInvalidated())
+            invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -563,6 +577,9 @@ namespace tgui
                 }
             }
         }
+
+        if (m_scroll.wasInvalidated())
+            invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -585,6 +602,9 @@ namespace tgui
         Widget::mouseNoLongerOnWidget();
         m_scroll.mouseNoLongerOnWidget();
 
+        if (m_scroll.wasInvalidated())
+            invalidate();
+
         updateHoveringItem(-1);
 
         m_possibleDoubleClick = false;
@@ -596,6 +616,9 @@ namespace tgui
     {
         Widget::mouseNoLongerDown();
         m_scroll.mouseNoLongerDown();
+
+        if (m_scroll.wasInvalidated())
+            invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -739,6 +762,7 @@ namespace tgui
 
     void ListBox::updateSelectedAndHoveringItemColorsAndStyle()
     {
+        invalidate();
         if (m_selectedItem >= 0)
         {
             if ((m_selectedItem == m_hoveringItem) && m_selectedTextColorHoverCached.isSet())
@@ -45,6 +45,7 @@ namespace tgui
     MenuBar::MenuBar()
     {
         m_type = "MenuBar";
+        m_hitAreaInFullSize = false;
 
         m_renderer = aurora::makeCopied<MenuBarRenderer>();
         setRenderer(RendererData::create(defaultRendererValues));
@@ -84,6 +85,7 @@ namespace tgui
 
     void MenuBar::addMenu(const sf::String& text)
     {
+        invalidate();
         Menu newMenu;
         newMenu.text.setFont(m_fontCached);
         newMenu.text.setColor(m_textColorCached);
@@ -97,6 +99,8 @@ namespace tgui
 
     bool MenuBar::addMenuItem(const sf::String& menu, const sf::String& text)
     {
+        invalidate();
+
         // Search for the menu
         for (unsigned int i = 0; i < m_menus.size(); ++i)
         {
@@ -123,6 +127,7 @@ namespace tgui
 
     bool MenuBar::addMenuItem(const sf::String& text)
     {
+        invalidate();
         if (!m_menus.empty())
             return addMenuItem(m_menus.back().text.getString(), text);
         else
@@ -133,6 +138,8 @@ namespace tgui
 
     bool MenuBar::removeMenu(const sf::String& menu)
     {
+        invalidate();
+
         // Search for the menu
         for (unsigned int i = 0; i < m_menus.size(); ++i)
         {
@@ -157,6 +164,8 @@ namespace tgui
 
     bool MenuBar::removeMenuItem(const sf::String& menu, const sf::String& menuItem)
     {
+        invalidate();
+
         // Search for the menu
         for (unsigned int i = 0; i < m_menus.size(); ++i)
         {
@@ -188,6 +197,7 @@ namespace tgui
 
     void MenuBar::removeAllMenus()
     {
+        invalidate();
         m_menus.clear();
     }
 
@@ -195,6 +205,7 @@ namespace tgui
 
     void MenuBar::setTextSize(unsigned int size)
     {
+        invalidate();
         m_textSize = size;
 
         for (unsigned int i = 0; i < m_menus.size(); ++i)
@@ -263,6 +274,8 @@ namespace tgui
 
     void MenuBar::closeMenu()
     {
+        invalidate();
+
         // Check if there is still a menu open
         if (m_visibleMenu != -1)
         {
@@ -332,6 +345,37 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    sf::FloatRect MenuBar::getDrawBounds() const
+    {
+        sf::FloatRect bounds = Widget::getDrawBounds();
+        if (m_visibleMenu == -1)
+            return bounds;
+
+        // Search the left position of the open menu
+        float left = 0;
+        for (int i = 0; i < m_visibleMenu; ++i)
+            left += m_menus[i].text.getSize().x + (2 * m_distanceToSideCached);
+
+        // Find out what the width of the menu should be
+        float width = m_minimumSubMenuWidth;
+        for (unsigned int j = 0; j < m_menus[m_visibleMenu].menuItems.size(); ++j)
+        {
+            if (width < m_menus[m_visibleMenu].menuItems[j].getSize().x + (3 * m_distanceToSideCached))
+                width = m_menus[m_visibleMenu].menuItems[j].getSize().x + (3 * m_distanceToSideCached);
+        }
+
+        // The open menu is drawn above or below the menu bar
+        const float menuHeight = getSize().y * m_menus[m_visibleMenu].menuItems.size();
+        if (m_invertedMenuDirection)
+            bounds.top -= menuHeight;
+
+        bounds.height += menuHeight;
+        bounds.width = std::max(bounds.width, left + width);
+        return bounds;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void MenuBar::leftMousePressed(sf::Vector2f pos)
     {
         // Check if a menu should be opened or closed
@@ -368,6 +412,7 @@ namespace tgui
                         m_visibleMenu = static_cast<int>(i);
                     }
 
+                    invalidate();
                     break;
                 }
             }
@@ -435,6 +480,7 @@ namespace tgui
                             {
                                 m_menus[m_visibleMenu].menuItems[m_menus[m_visibleMenu].selectedMenuItem].setColor(m_textColorCached);
                                 m_menus[m_visibleMenu].selectedMenuItem = -1;
+                                invalidate();
                             }
                         }
                         else // The menu isn't open yet
@@ -470,6 +516,8 @@ namespace tgui
             // Check if the mouse is on a different item than before
             if (selectedMenuItem != m_menus[m_visibleMenu].selectedMenuItem)
             {
+                invalidate();
+
                 // If another of the menu items is selected then unselect it
                 if (m_menus[m_visibleMenu].selectedMenuItem != -1)
                     m_menus[m_visibleMenu].menuItems[m_menus[m_visibleMenu].selectedMenuItem].setColor(m_textColorCached);
@@ -65,6 +65,7 @@ namespace tgui
 
     void Picture::setTexture(const Texture& texture, bool fullyClickable)
     {
+        invalidate();
         if (!m_sprite.isSet() && (texture.getImageSize() != sf::Vector2f{0,0}))
             setSize(texture.getImageSize());
 
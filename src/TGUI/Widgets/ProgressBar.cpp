@@ -186,6 +186,8 @@ namespace tgui
 
     void ProgressBar::setText(const sf::String& text)
     {
+        invalidate();
+
         // Set the new text
         m_textBack.setString(text);
         m_textFront.setString(text);
@@ -225,6 +227,8 @@ namespace tgui
 
     void ProgressBar::setTextSize(unsigned int size)
     {
+        invalidate();
+
         // Change the text size
         m_textSize = size;
         setText(getText());
@@ -342,6 +346,7 @@ namespace tgui
 
     void ProgressBar::recalculateFillSize()
     {
+        invalidate();
         sf::Vector2f size;
         if (m_spriteFill.isSet())
         {
@@ -24,6 +24,7 @@
 
 
 #include <TGUI/Widgets/RadioButton.hpp>
+#include <TGUI/DrawBatch.hpp>
 #include <TGUI/Container.hpp>
 #include <SFML/Graphics/CircleShape.hpp>
 
@@ -112,6 +113,7 @@ namespace tgui
 
     void RadioButton::check()
     {
+        invalidate();
         if (!m_checked)
         {
             // Tell our parent that all the radio buttons should be unchecked
@@ -135,6 +137,7 @@ namespace tgui
 
     void RadioButton::uncheck()
     {
+        invalidate();
         if (m_checked)
         {
             m_checked = false;
@@ -150,6 +153,8 @@ namespace tgui
 
     void RadioButton::setText(const sf::String& text)
     {
+        invalidate();
+
         // Set the new text
         m_text.setString(text);
 
@@ -158,6 +163,9 @@ namespace tgui
             m_text.setCharacterSize(Text::findBestTextSize(m_fontCached, getSize().y * 0.8f));
         else
             m_text.setCharacterSize(m_textSize);
+
+        // The text is part of the full size of the radio button
+        hitAreaChanged();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -171,6 +179,7 @@ namespace tgui
 
     void RadioButton::setTextSize(unsigned int size)
     {
+        invalidate();
         m_textSize = size;
         setText(getText());
     }
@@ -553,6 +562,7 @@ namespace tgui
 
     void RadioButton::updateTextColor()
     {
+        invalidate();
         if (m_checked)
         {
             if (!m_enabled && getRenderer()->getTextColorCheckedDisabled().isSet())
@@ -603,7 +613,7 @@ namespace tgui
             circle.setOutlineThickness(-m_bordersCached.getLeft());
             circle.setFillColor(sf::Color::Transparent);
             circle.setOutlineColor(Color::calcColorOpacity(getCurrentBorderColor(), m_opacityCached));
-            target.draw(circle, states);
+            DrawBatch::draw(target, circle, states);
         }
 
         // Draw the box
@@ -637,7 +647,7 @@ namespace tgui
         {
             sf::CircleShape circle{innerRadius};
             circle.setFillColor(Color::calcColorOpacity(getCurrentBackgroundColor(), m_opacityCached));
-            target.draw(circle, states);
+            DrawBatch::draw(target, circle, states);
 
             // Draw the check if the radio button is checked
             if (m_checked)
@@ -645,7 +655,7 @@ namespace tgui
                 sf::CircleShape checkShape{innerRadius * .6f};
                 checkShape.setFillColor(Color::calcColorOpacity(getCurrentCheckColor(), m_opacityCached));
                 checkShape.setPosition({innerRadius - checkShape.getRadius(), innerRadius - checkShape.getRadius()});
-                target.draw(checkShape, states);
+                DrawBatch::draw(target, checkShape, states);
             }
         }
         states.transform.translate({-m_bordersCached.getLeft(), -m_bordersCached.getLeft()});
@@ -24,6 +24,7 @@
 
 
 #include <TGUI/Widgets/Scrollbar.hpp>
+#include <TGUI/DrawBatch.hpp>
 #include <SFML/Graphics/ConvexShape.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -211,6 +212,8 @@ namespace tgui
 
     void Scrollbar::setMaximum(unsigned int maximum)
     {
+        invalidate();
+
         // Set the new maximum
         if (maximum > 0)
             m_maximum = maximum;
@@ -266,6 +269,8 @@ namespace tgui
 
     void Scrollbar::setLowValue(unsigned int lowValue)
     {
+        invalidate();
+
         // Set the new value
         m_lowValue = lowValue;
 
@@ -304,6 +309,7 @@ namespace tgui
 
     void Scrollbar::setAutoHide(bool autoHide)
     {
+        invalidate();
         m_autoHide = autoHide;
     }
 
@@ -333,6 +339,7 @@ namespace tgui
 
         m_mouseDown = true;
         m_mouseDownOnArrow = false;
+        invalidate();
 
         if (m_verticalScroll)
         {
@@ -484,6 +491,9 @@ namespace tgui
             if (!m_autoHide && (m_maximum <= m_lowValue))
                 return;
 
+            // The thumb follows the mouse, even when the value doesn't change
+            invalidate();
+
             // Check in which direction the scrollbar lies
             if (m_verticalScroll)
             {
@@ -622,6 +632,7 @@ namespace tgui
             }
         }
 
+        const Part oldHoverPart = m_mouseHoverOverPart;
         if (sf::FloatRect{m_thumb.left, m_thumb.top, m_thumb.width, m_thumb.height}.contains(pos))
             m_mouseHoverOverPart = Part::Thumb;
         else if (sf::FloatRect{m_track.left, m_track.top, m_track.width, m_track.height}.contains(pos))
@@ -630,6 +641,9 @@ namespace tgui
             m_mouseHoverOverPart = Part::ArrowUp;
         else if (sf::FloatRect{m_arrowDown.left, m_arrowDown.top, m_arrowDown.width, m_arrowDown.height}.contains(pos))
             m_mouseHoverOverPart = Part::ArrowDown;
+
+        if (m_mouseHoverOverPart != oldHoverPart)
+            invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -767,6 +781,7 @@ namespace tgui
 
     void Scrollbar::updateThumbPosition()
     {
+        invalidate();
         if (m_verticalScroll)
         {
             m_thumb.left = 0;
@@ -827,7 +842,7 @@ namespace tgui
                 arrow.setPoint(2, {m_arrowUp.width * 4/5, m_arrowUp.height * 4/5});
             }
 
-            target.draw(arrow, states);
+            DrawBatch::draw(target, arrow, states);
         }
 
         // Draw the track
@@ -901,7 +916,7 @@ namespace tgui
                 arrow.setPoint(2, {m_arrowDown.width / 5, m_arrowDown.height * 4/5});
             }
 
-            target.draw(arrow, states);
+            DrawBatch::draw(target, arrow, states);
         }
     }
 
@@ -928,6 +943,22 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ScrollbarChildWidget::invalidate()
+    {
+        m_invalidated = true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool ScrollbarChildWidget::wasInvalidated()
+    {
+        const bool invalidated = m_invalidated;
+        m_invalidated = false;
+        return invalidated;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -300,6 +300,9 @@ namespace tgui
         // Check if the mouse button is down
         if (m_mouseDown)
         {
+            // The thumb follows the mouse, even when the value doesn't change
+            invalidate();
+
             // Check in which direction the slider goes
             if (m_verticalScroll)
             {
@@ -483,6 +486,7 @@ namespace tgui
 
     void Slider::updateThumbPosition()
     {
+        invalidate();
         if (m_verticalScroll)
         {
             m_thumb.left = (getSize().x - m_thumb.width) / 2.0f;
@@ -23,6 +23,7 @@
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 #include <TGUI/Widgets/SpinButton.hpp>
+#include <TGUI/DrawBatch.hpp>
 #include <SFML/Graphics/ConvexShape.hpp>
 #include <SFML/Graphics/RectangleShape.hpp>
 
@@ -94,6 +95,8 @@ namespace tgui
 
     void SpinButton::setMinimum(int minimum)
     {
+        invalidate();
+
         // Set the new minimum
         m_minimum = minimum;
 
@@ -117,6 +120,7 @@ namespace tgui
 
     void SpinButton::setMaximum(int maximum)
     {
+        invalidate();
         m_maximum = maximum;
 
         // The maximum can never be below the minimum
@@ -139,6 +143,8 @@ namespace tgui
 
     void SpinButton::setValue(int value)
     {
+        invalidate();
+
         // When the value is below the minimum or above the maximum then adjust it
         if (value < m_minimum)
             value = m_minimum;
@@ -260,6 +266,8 @@ namespace tgui
 
     void SpinButton::mouseMoved(sf::Vector2f pos)
     {
+        const bool mouseHoverOnTopArrow = m_mouseHoverOnTopArrow;
+
         // Check if the mouse is on top of the upper/right arrow
         if (m_verticalScroll)
         {
@@ -276,6 +284,9 @@ namespace tgui
                 m_mouseHoverOnTopArrow = false;
         }
 
+        if (m_mouseHoverOnTopArrow != mouseHoverOnTopArrow)
+            invalidate();
+
         if (!m_mouseHover)
             mouseEnteredWidget();
     }
@@ -428,8 +439,8 @@ namespace tgui
             else
                 arrow.setFillColor(Color::calcColorOpacity(m_arrowColorCached, m_opacityCached));
 
-            target.draw(arrowBack, states);
-            target.draw(arrow, states);
+            DrawBatch::draw(target, arrowBack, states);
+            DrawBatch::draw(target, arrow, states);
         }
 
         // Draw the space between the arrows (if there is space)
@@ -494,8 +505,8 @@ namespace tgui
             else
                 arrow.setFillColor(Color::calcColorOpacity(m_arrowColorCached, m_opacityCached));
 
-            target.draw(arrowBack, states);
-            target.draw(arrow, states);
+            DrawBatch::draw(target, arrowBack, states);
+            DrawBatch::draw(target, arrow, states);
         }
     }
 
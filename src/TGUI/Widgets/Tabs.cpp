@@ -170,6 +170,7 @@ namespace tgui
 
     void Tabs::select(const sf::String& text)
     {
+        invalidate();
         for (unsigned int i = 0; i < m_tabTexts.size(); ++i)
         {
             if (m_tabTexts[i].getString() == text)
@@ -184,6 +185,8 @@ namespace tgui
 
     void Tabs::select(std::size_t index)
     {
+        invalidate();
+
         // If the index is too big then do nothing
         if (index > m_tabTexts.size() - 1)
             return;
@@ -207,6 +210,7 @@ namespace tgui
 
     void Tabs::deselect()
     {
+        invalidate();
         if (m_selectedTab >= 0)
             m_tabTexts[m_selectedTab].setColor(m_textColorCached);
 
@@ -393,6 +397,7 @@ namespace tgui
         Widget::mouseMoved(pos);
 
         pos -= getPosition();
+        const int oldHoveringTab = m_hoveringTab;
         m_hoveringTab = -1;
         float width = m_bordersCached.getLeft() / 2.f;
 
@@ -409,6 +414,9 @@ namespace tgui
                 break;
             }
         }
+
+        if (m_hoveringTab != oldHoveringTab)
+            invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -424,6 +432,7 @@ namespace tgui
 
     void Tabs::recalculateTabsWidth()
     {
+        invalidate();
         if (m_autoSize)
         {
             if (m_tabWidth.empty())
@@ -560,6 +569,7 @@ namespace tgui
 
     void Tabs::updateTextColors()
     {
+        invalidate();
         for (auto& tabText : m_tabTexts)
             tabText.setColor(m_textColorCached);
 
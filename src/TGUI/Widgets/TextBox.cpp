@@ -27,8 +27,11 @@
 #include <TGUI/Widgets/Scrollbar.hpp>
 #include <TGUI/Widgets/TextBox.hpp>
 #include <TGUI/Clipping.hpp>
+#include <TGUI/FontMetrics.hpp>
 
+#include <algorithm>
 #include <cmath>
+#include <limits>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -107,26 +110,79 @@ namespace tgui
 
     void TextBox::setText(const sf::String& text)
     {
+        // Stop showing the file that was opened with openDocument
+        m_document = nullptr;
+        m_documentTexts.clear();
+
         // Remove all the excess characters when a character limit is set
         if ((m_maxChars > 0) && (text.getSize() > m_maxChars))
             m_text = text.substring(0, m_maxChars);
         else
             m_text = text;
 
+        m_textCached = true;
+        m_textLength = m_text.getSize();
+
         rearrangeText(false);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool TextBox::openDocument(const std::string& filename)
+    {
+        auto document = std::make_shared<TextDocument>();
+        if (!document->open(filename))
+            return false;
+
+        // The text that was in the text box is no longer needed
+        setText("");
+        m_document = document;
+
+        rearrangeDocument();
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool TextBox::isDocumentOpen() const
+    {
+        return m_document != nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void TextBox::addText(const sf::String& text)
     {
-        setText(m_text + text);
+        // The document that is being shown can't be changed
+        if (m_document)
+            return;
+
+        // Remove all the excess characters when a character limit is set
+        sf::String addedText = text;
+        if ((m_maxChars > 0) && (m_textLength + text.getSize() > m_maxChars))
+            addedText = (m_textLength < m_maxChars) ? text.substring(0, m_maxChars - m_textLength) : "";
+
+        const sf::Vector2<std::size_t> endPosition{m_lines.back().getSize(), m_lines.size() - 1};
+        replaceText(endPosition, endPosition, addedText);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     const sf::String& TextBox::getText() const
     {
+        if (!m_textCached)
+        {
+            m_text.clear();
+            for (std::size_t i = 0; i < m_lines.size(); ++i)
+            {
+                m_text += m_lines[i];
+                if (m_newlineAfterLine[i])
+                    m_text += '\n';
+            }
+
+            m_textCached = true;
+        }
+
         return m_text;
     }
 
@@ -134,7 +190,24 @@ namespace tgui
 
     sf::String TextBox::getSelectedText() const
     {
-        return m_textSelection1.getString() + m_textSelection2.getString();
+        auto selectionStart = m_selStart;
+        auto selectionEnd = m_selEnd;
+
+        if ((m_selStart.y > m_selEnd.y) || ((m_selStart.y == m_selEnd.y) && (m_selStart.x > m_selEnd.x)))
+            std::swap(selectionStart, selectionEnd);
+
+        sf::String selectedText;
+        for (std::size_t i = selectionStart.y; i <= selectionEnd.y; ++i)
+        {
+            const std::size_t first = (i == selectionStart.y) ? selectionStart.x : 0;
+            const std::size_t last = (i == selectionEnd.y) ? selectionEnd.x : m_lines[i].getSize();
+            selectedText += m_lines[i].substring(first, last - first);
+
+            if ((i < selectionEnd.y) && m_newlineAfterLine[i])
+                selectedText += '\n';
+        }
+
+        return selectedText;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -176,11 +249,10 @@ namespace tgui
         m_maxChars = maxChars;
 
         // If there is a character limit then check if it is exceeded
-        if ((m_maxChars > 0) && (m_text.getSize() > m_maxChars))
+        if ((m_maxChars > 0) && (m_textLength > m_maxChars))
         {
             // Remove all the excess characters
-            m_text.erase(m_maxChars, sf::String::InvalidPos);
-            rearrangeText(false);
+            replaceText(findPosition(m_maxChars), {m_lines.back().getSize(), m_lines.size() - 1}, "");
         }
     }
 
@@ -219,29 +291,13 @@ namespace tgui
     void TextBox::setCaretPosition(std::size_t charactersBeforeCaret)
     {
         // The caret position has to stay inside the string
-        if (charactersBeforeCaret > m_text.getSize())
-            charactersBeforeCaret = m_text.getSize();
+        if (charactersBeforeCaret > m_textLength)
+            charactersBeforeCaret = m_textLength;
 
         // Find the line and position on that line on which the caret is located
-        std::size_t count = 0;
-        for (std::size_t i = 0; i < m_lines.size(); ++i)
-        {
-            if (count + m_lines[i].getSize() < charactersBeforeCaret)
-            {
-                count += m_lines[i].getSize();
-                if ((count < m_text.getSize()) && (m_text[count] == '\n'))
-                    count += 1;
-            }
-            else
-            {
-                m_selStart.y = i;
-                m_selStart.x = charactersBeforeCaret - count;
-
-                m_selEnd = m_selStart;
-                updateSelectionTexts();
-                break;
-            }
-        }
+        m_selStart = findPosition(charactersBeforeCaret);
+        m_selEnd = m_selStart;
+        updateSelectionTexts();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -269,6 +325,9 @@ namespace tgui
 
     std::size_t TextBox::getLinesCount() const
     {
+        if (m_document)
+            return m_document->getLineCount();
+
         return m_lines.size();
     }
 
@@ -293,8 +352,11 @@ namespace tgui
         {
             m_verticalScroll.leftMousePressed(pos);
             recalculateVisibleLines();
+
+            if (m_verticalScroll.wasInvalidated())
+                invalidate();
         }
-        else // The click occurred on the text box
+        else if (!m_document) // The click occurred on the text box, text in a document can't be selected
         {
             // Don't continue when line height is 0
             if (m_lineHeight == 0)
@@ -377,6 +439,9 @@ namespace tgui
             {
                 m_verticalScroll.leftMouseReleased(pos - getPosition());
                 recalculateVisibleLines();
+
+                if (m_verticalScroll.wasInvalidated())
+                    invalidate();
             }
         }
     }
@@ -401,7 +466,7 @@ namespace tgui
         }
 
         // If the mouse is held down then you are selecting text
-        else if (m_mouseDown)
+        else if (m_mouseDown && !m_document)
         {
             const sf::Vector2<std::size_t> caretPosition = findCaretPosition(pos);
             if (caretPosition != m_selEnd)
@@ -421,6 +486,9 @@ namespace tgui
                 recalculateVisibleLines();
             }
         }
+
+        if (m_verticalScroll.wasInvalidated())
+            invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -432,6 +500,9 @@ namespace tgui
 
         if (m_verticalScroll.isShown())
             m_verticalScroll.mouseNoLongerOnWidget();
+
+        if (m_verticalScroll.wasInvalidated())
+            invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -442,12 +513,50 @@ namespace tgui
 
         if (m_verticalScroll.isShown())
             m_verticalScroll.mouseNoLongerDown();
+
+        if (m_verticalScroll.wasInvalidated())
+            invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void TextBox::keyPressed(const sf::Event::KeyEvent& event)
     {
+        // A document can only be scrolled with the keyboard
+        if (m_document)
+        {
+            if (!m_verticalScroll.isShown())
+                return;
+
+            const unsigned int value = m_verticalScroll.getValue();
+            switch (event.code)
+            {
+                case sf::Keyboard::Up:
+                    m_verticalScroll.setValue((value > m_lineHeight) ? value - m_lineHeight : 0);
+                    break;
+                case sf::Keyboard::Down:
+                    m_verticalScroll.setValue(value + m_lineHeight);
+                    break;
+                case sf::Keyboard::PageUp:
+                    m_verticalScroll.setValue((value > m_verticalScroll.getLowValue()) ? value - m_verticalScroll.getLowValue() : 0);
+                    break;
+                case sf::Keyboard::PageDown:
+                    m_verticalScroll.setValue(value + m_verticalScroll.getLowValue());
+                    break;
+                case sf::Keyboard::Home:
+                    m_verticalScroll.setValue(0);
+                    break;
+                case sf::Keyboard::End:
+                    m_verticalScroll.setValue(m_verticalScroll.getMaximum());
+                    break;
+                default:
+                    return;
+            }
+
+            updateDocumentTexts();
+            return;
+        }
+
         switch (event.code)
         {
             case sf::Keyboard::Up:
@@ -702,39 +811,24 @@ namespace tgui
                 // Check that we did not select any characters
                 if (m_selStart == m_selEnd)
                 {
-                    const std::size_t pos = findTextSelectionPositions().second;
-                    if (pos > 0)
+                    // Find the position in front of the character that has to be removed
+                    sf::Vector2<std::size_t> pos = m_selEnd;
+                    if (pos.x > 0)
+                        --pos.x;
+                    else if (pos.y > 0)
                     {
-                        if (m_selEnd.x > 0)
-                        {
-                            // There is a specific case that we have to watch out for. When we are removing the last character on
-                            // a line which was placed there by word wrap and a newline follows this character then the caret
-                            // has to be placed at the line above (before the newline) instead of at the same line (after the newline)
-                            if ((m_lines[m_selEnd.y].getSize() == 1) && (pos > 1) && (pos < m_text.getSize()) && (m_text[pos-2] != '\n') && (m_text[pos] == '\n') && (m_selEnd.y > 0))
-                            {
-                                m_selEnd.y--;
-                                m_selEnd.x = m_lines[m_selEnd.y].getSize();
-                            }
-                            else // Just remove the character normally
-                                --m_selEnd.x;
-                        }
-                        else // At the beginning of the line
-                        {
-                            if (m_selEnd.y > 0)
-                            {
-                                --m_selEnd.y;
-                                m_selEnd.x = m_lines[m_selEnd.y].getSize();
+                        --pos.y;
+                        pos.x = m_lines[pos.y].getSize();
 
-                                if ((m_text[pos-1] != '\n') && m_selEnd.x > 0)
-                                    --m_selEnd.x;
-                            }
-                        }
-
-                        m_selStart = m_selEnd;
-
-                        m_text.erase(pos - 1, 1);
-                        rearrangeText(true);
+                        // When the line was split by word wrap then there is no newline to remove, the last character on the line
+                        // above is removed instead.
+                        if (!m_newlineAfterLine[pos.y] && (pos.x > 0))
+                            --pos.x;
                     }
+
+                    // The caret ends up at the correct line because the paragraph is word-wrapped again after the removal
+                    if (pos != m_selEnd)
+                        replaceText(pos, m_selEnd, "");
                 }
                 else // When you did select some characters then delete them
                     deleteSelectedCharacters();
@@ -743,7 +837,9 @@ namespace tgui
                 m_caretVisible = true;
                 m_animationTimeElapsed = {};
 
-                onTextChange.emit(this, m_text);
+                // The whole text is only created when somebody is going to receive it
+                if (!onTextChange.isEmpty())
+                    onTextChange.emit(this, getText());
                 break;
             }
 
@@ -755,13 +851,25 @@ namespace tgui
                 // Check that we did not select any characters
                 if (m_selStart == m_selEnd)
                 {
-                    m_text.erase(findTextSelectionPositions().second, 1);
-                    rearrangeText(true);
+                    // Find the position behind the character that has to be removed
+                    sf::Vector2<std::size_t> pos = m_selEnd;
+                    if (pos.x < m_lines[pos.y].getSize())
+                        ++pos.x;
+                    else if (pos.y + 1 < m_lines.size())
+                    {
+                        // When the line was split by word wrap then the first character of the next line is removed
+                        ++pos.y;
+                        pos.x = m_newlineAfterLine[pos.y - 1] ? 0 : 1;
+                    }
+
+                    if (pos != m_selEnd)
+                        replaceText(m_selEnd, pos, "");
                 }
                 else // You did select some characters, so remove them
                     deleteSelectedCharacters();
 
-                onTextChange.emit(this, m_text);
+                if (!onTextChange.isEmpty())
+                    onTextChange.emit(this, getText());
                 break;
             }
 
@@ -779,12 +887,8 @@ namespace tgui
 
             case sf::Keyboard::C:
             {
-                auto selectionPositions = findTextSelectionPositions();
-                if (selectionPositions.first > selectionPositions.second)
-                    std::swap(selectionPositions.first, selectionPositions.second);
-
                 if (event.control && !event.alt && !event.shift && !event.system)
-                    Clipboard::set(m_text.substring(selectionPositions.first, selectionPositions.second - selectionPositions.first));
+                    Clipboard::set(getSelectedText());
 
                 break;
             }
@@ -793,11 +897,7 @@ namespace tgui
             {
                 if (event.control && !event.alt && !event.shift && !event.system && !m_readOnly)
                 {
-                    auto selectionPositions = findTextSelectionPositions();
-                    if (selectionPositions.first > selectionPositions.second)
-                        std::swap(selectionPositions.first, selectionPositions.second);
-
-                    Clipboard::set(m_text.substring(selectionPositions.first, selectionPositions.second - selectionPositions.first));
+                    Clipboard::set(getSelectedText());
                     deleteSelectedCharacters();
                 }
 
@@ -813,16 +913,10 @@ namespace tgui
                     // Only continue pasting if you actually have to do something
                     if ((m_selStart != m_selEnd) || (clipboardContents != ""))
                     {
-                        deleteSelectedCharacters();
-
-                        m_text.insert(findTextSelectionPositions().first, clipboardContents);
-                        m_lines[m_selStart.y].insert(m_selStart.x, clipboardContents);
+                        replaceSelectedCharacters(clipboardContents);
 
-                        m_selStart.x += clipboardContents.getSize();
-                        m_selEnd = m_selStart;
-                        rearrangeText(true);
-
-                        onTextChange.emit(this, m_text);
+                        if (!onTextChange.isEmpty())
+                            onTextChange.emit(this, getText());
                     }
                 }
 
@@ -842,51 +936,37 @@ namespace tgui
 
     void TextBox::textEntered(sf::Uint32 key)
     {
-        if (m_readOnly)
+        if (m_readOnly || m_document)
             return;
 
         // Make sure we don't exceed our maximum characters limit
-        if ((m_maxChars > 0) && (m_text.getSize() + 1 > m_maxChars))
+        if ((m_maxChars > 0) && (m_textLength + 1 > m_maxChars))
             return;
 
-        auto insert = [=]()
-        {
-            deleteSelectedCharacters();
-
-            const std::size_t caretPosition = findTextSelectionPositions().first;
-
-            m_text.insert(caretPosition, key);
-            m_lines[m_selEnd.y].insert(m_selEnd.x, key);
-
-            m_selStart.x++;
-            m_selEnd.x++;
-
-            rearrangeText(true);
-        };
-
         // If there is a scrollbar then inserting can't go wrong
         if (isVerticalScrollbarPresent())
         {
-            insert();
+            replaceSelectedCharacters(key);
         }
         else // There is no scrollbar, the text may not fit
         {
             // Store the data so that it can be reverted
-            sf::String oldText = m_text;
+            const sf::String replacedText = getSelectedText();
             const auto oldSelStart = m_selStart;
             const auto oldSelEnd = m_selEnd;
+            const std::size_t insertIndex = std::min(findIndex(m_selStart), findIndex(m_selEnd));
 
             // Try to insert the character
-            insert();
+            replaceSelectedCharacters(key);
 
-            // Undo the insert if the text does not fit
-            if (oldText.getSize() + 1 != m_text.getSize())
+            // Undo the insert if it replaced selected characters
+            if (!replacedText.isEmpty())
             {
-                m_text = oldText;
+                replaceText(findPosition(insertIndex), m_selEnd, replacedText);
+
                 m_selStart = oldSelStart;
                 m_selEnd = oldSelEnd;
-
-                rearrangeText(true);
+                updateSelectionTexts();
             }
         }
 
@@ -894,7 +974,8 @@ namespace tgui
         m_caretVisible = true;
         m_animationTimeElapsed = {};
 
-        onTextChange.emit(this, m_text);
+        if (!onTextChange.isEmpty())
+            onTextChange.emit(this, getText());
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -905,6 +986,9 @@ namespace tgui
         {
             m_verticalScroll.mouseWheelScrolled(delta, pos - getPosition());
             recalculateVisibleLines();
+
+            if (m_verticalScroll.wasInvalidated())
+                invalidate();
         }
     }
 
@@ -970,6 +1054,7 @@ namespace tgui
             return sf::Vector2<std::size_t>(m_lines[m_lines.size()-1].getSize(), m_lines.size()-1);
 
         // Find between which character the mouse is standing
+        const FontMetrics& metrics = FontMetrics::get(m_fontCached, getTextSize(), false);
         float width = 0;
         sf::Uint32 prevChar = 0;
         for (std::size_t i = 0; i < m_lines[lineNumber].getSize(); ++i)
@@ -980,11 +1065,11 @@ namespace tgui
             //    return sf::Vector2<std::size_t>(m_lines[lineNumber].getSize() - 1, lineNumber); // TextBox strips newlines but this code is kept for when this function is generalized
             //else
             if (curChar == '\t')
-                charWidth = static_cast<float>(m_fontCached.getGlyph(' ', getTextSize(), false).advance) * 4;
+                charWidth = metrics.getAdvance(' ') * 4;
             else
-                charWidth = static_cast<float>(m_fontCached.getGlyph(curChar, getTextSize(), false).advance);
+                charWidth = metrics.getAdvance(curChar);
 
-            const float kerning = static_cast<float>(m_fontCached.getKerning(prevChar, curChar, getTextSize()));
+            const float kerning = metrics.getKerning(prevChar, curChar);
             if (width + charWidth + kerning <= position.x)
                 width += charWidth + kerning;
             else
@@ -1006,21 +1091,40 @@ namespace tgui
 
     std::pair<std::size_t, std::size_t> TextBox::findTextSelectionPositions() const
     {
-        // This function is used to count the amount of characters spread over several lines
-        auto findIndex = [this](std::size_t line)
+        return {findIndex(m_selStart), findIndex(m_selEnd)};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t TextBox::findIndex(sf::Vector2<std::size_t> position) const
+    {
+        std::size_t index = 0;
+        for (std::size_t i = 0; i < position.y; ++i)
         {
-            std::size_t counter = 0;
-            for (std::size_t i = 0; i < line; ++i)
-            {
-                counter += m_lines[i].getSize();
-                if ((counter < m_text.getSize()) && (m_text[counter] == '\n'))
-                    counter += 1;
-            }
+            index += m_lines[i].getSize();
+            if (m_newlineAfterLine[i])
+                ++index;
+        }
+
+        return index + position.x;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::Vector2<std::size_t> TextBox::findPosition(std::size_t index, std::size_t firstLine) const
+    {
+        // When the index lies between two lines that were split by word wrap, the position at the end of the first line is used
+        for (std::size_t i = firstLine; i < m_lines.size(); ++i)
+        {
+            if (index <= m_lines[i].getSize())
+                return {index, i};
 
-            return counter;
-        };
+            index -= m_lines[i].getSize();
+            if (m_newlineAfterLine[i])
+                --index;
+        }
 
-        return {findIndex(m_selStart.y) + m_selStart.x, findIndex(m_selEnd.y) + m_selEnd.x};
+        return {m_lines.back().getSize(), m_lines.size() - 1};
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1028,120 +1132,158 @@ namespace tgui
     void TextBox::deleteSelectedCharacters()
     {
         if (m_selStart != m_selEnd)
-        {
-            auto textSelectionPositions = findTextSelectionPositions();
+            replaceSelectedCharacters("");
+    }
 
-            if ((m_selStart.y > m_selEnd.y) || ((m_selStart.y == m_selEnd.y) && (m_selStart.x > m_selEnd.x)))
-            {
-                m_text.erase(textSelectionPositions.second, textSelectionPositions.first - textSelectionPositions.second);
-                m_selStart = m_selEnd;
-            }
-            else
-            {
-                m_text.erase(textSelectionPositions.first, textSelectionPositions.second - textSelectionPositions.first);
-                m_selEnd = m_selStart;
-            }
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-            rearrangeText(true);
-        }
+    void TextBox::replaceSelectedCharacters(const sf::String& text)
+    {
+        if ((m_selStart.y > m_selEnd.y) || ((m_selStart.y == m_selEnd.y) && (m_selStart.x > m_selEnd.x)))
+            replaceText(m_selEnd, m_selStart, text);
+        else
+            replaceText(m_selStart, m_selEnd, text);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void TextBox::rearrangeText(bool keepSelection)
+    void TextBox::replaceText(sf::Vector2<std::size_t> start, sf::Vector2<std::size_t> end, const sf::String& text)
     {
-        // Don't continue when line height is 0 or when there is no font yet
-        if ((m_lineHeight == 0) || (m_fontCached == nullptr))
-            return;
+        invalidate();
+
+        // Find the first line of the paragraph containing the start position and the last line of the one containing the end
+        std::size_t firstLine = start.y;
+        while ((firstLine > 0) && !m_newlineAfterLine[firstLine - 1])
+            --firstLine;
+
+        std::size_t lastLine = end.y;
+        while ((lastLine + 1 < m_lines.size()) && !m_newlineAfterLine[lastLine])
+            ++lastLine;
+
+        // Put the paragraphs together and make the change in them
+        sf::String paragraphs;
+        std::size_t startIndex = 0;
+        std::size_t endIndex = 0;
+        for (std::size_t i = firstLine; i <= lastLine; ++i)
+        {
+            if (i == start.y)
+                startIndex = paragraphs.getSize() + start.x;
+            if (i == end.y)
+                endIndex = paragraphs.getSize() + end.x;
+
+            paragraphs += m_lines[i];
+            if ((i < lastLine) && m_newlineAfterLine[i])
+                paragraphs += '\n';
+        }
 
-        // Find the maximum width of one line
-        float maxLineWidth = getInnerSize().x - m_paddingCached.getLeft() - m_paddingCached.getRight();
-        if (m_verticalScroll.isShown())
-            maxLineWidth -= m_verticalScroll.getSize().x;
+        paragraphs.erase(startIndex, endIndex - startIndex);
+        paragraphs.insert(startIndex, text);
 
-        // Don't do anything when there is no room for the text
-        if (maxLineWidth <= 0)
+        m_textLength = m_textLength - (endIndex - startIndex) + text.getSize();
+        m_textCached = false;
+
+        // Word-wrap the changed paragraphs
+        std::vector<sf::String> lines;
+        std::vector<bool> newlineAfterLine;
+        wrapText(paragraphs, lines, newlineAfterLine);
+        newlineAfterLine.back() = m_newlineAfterLine[lastLine];
+
+        // Replace the old lines. The lines behind them only have to be moved when the amount of lines changed.
+        const std::size_t oldLineCount = lastLine - firstLine + 1;
+        if (lines.size() < oldLineCount)
+        {
+            m_lines.erase(m_lines.begin() + firstLine + lines.size(), m_lines.begin() + lastLine + 1);
+            m_newlineAfterLine.erase(m_newlineAfterLine.begin() + firstLine + lines.size(), m_newlineAfterLine.begin() + lastLine + 1);
+        }
+        else if (lines.size() > oldLineCount)
+        {
+            m_lines.insert(m_lines.begin() + lastLine + 1, lines.size() - oldLineCount, sf::String{});
+            m_newlineAfterLine.insert(m_newlineAfterLine.begin() + lastLine + 1, lines.size() - oldLineCount, false);
+        }
+
+        std::move(lines.begin(), lines.end(), m_lines.begin() + firstLine);
+        std::copy(newlineAfterLine.begin(), newlineAfterLine.end(), m_newlineAfterLine.begin() + firstLine);
+
+        // Place the caret behind the inserted text
+        m_selStart = findPosition(startIndex + text.getSize(), firstLine);
+        m_selEnd = m_selStart;
+
+        // Don't continue when line height is 0 or when there is no font yet
+        if ((m_lineHeight == 0) || (m_fontCached == nullptr))
             return;
 
-        // Store the current selection position when we are keeping the selection
-        std::pair<std::size_t, std::size_t> textSelectionPositions;
-        if (keepSelection)
-            textSelectionPositions = findTextSelectionPositions();
+        // Tell the scrollbar how many pixels the text contains
+        const bool scrollbarShown = m_verticalScroll.isShown();
 
-        // Fit the text in the available space
-        const sf::String string = Text::wordWrap(maxLineWidth, m_text, m_fontCached, m_textSize, false, false);
+        m_verticalScroll.setMaximum(static_cast<unsigned int>(m_lines.size() * m_lineHeight + Text::calculateExtraVerticalSpace(m_fontCached, m_textSize)));
 
-        // Split the string in multiple lines
-        m_lines.clear();
-        std::size_t searchPosStart = 0;
-        std::size_t newLinePos = 0;
-        while (newLinePos != sf::String::InvalidPos)
-        {
-            newLinePos = string.find('\n', searchPosStart);
+        // All lines have to be word-wrapped again if the scrollbar just appeared or disappeared
+        if (scrollbarShown != m_verticalScroll.isShown())
+            rearrangeText(true);
+        else
+            updateSelectionTexts();
+    }
 
-            if (newLinePos != sf::String::InvalidPos)
-                m_lines.push_back(string.substring(searchPosStart, newLinePos - searchPosStart));
-            else
-                m_lines.push_back(string.substring(searchPosStart));
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-            searchPosStart = newLinePos + 1;
-        }
+    void TextBox::wrapText(const sf::String& text, std::vector<sf::String>& lines, std::vector<bool>& newlineAfterLine) const
+    {
+        // Without a font or without room for the text, the paragraphs are kept on a single line until they can be word-wrapped
+        const float maxLineWidth = std::max(0.f, getMaximumLineWidth());
+        const std::vector<std::size_t> lineBreaks = Text::findLineBreaks(maxLineWidth, text, m_fontCached, m_textSize, false, false);
 
-        // Check if we should try to keep our selection
-        if (keepSelection)
+        std::size_t lineStart = 0;
+        for (std::size_t i = 0; i <= lineBreaks.size(); ++i)
         {
-            std::size_t index = 0;
-            sf::Vector2<std::size_t> newSelStart;
-            sf::Vector2<std::size_t> newSelEnd;
-            bool newSelStartFound = false;
-            bool newSelEndFound = false;
+            const std::size_t lineEnd = (i < lineBreaks.size()) ? lineBreaks[i] : text.getSize();
+            const bool newlineAfter = (lineEnd > lineStart) && (text[lineEnd - 1] == '\n');
 
-            // Look for the new locations of our selection
-            for (std::size_t i = 0; i < m_lines.size(); ++i)
-            {
-                index += m_lines[i].getSize();
+            lines.push_back(text.substring(lineStart, lineEnd - lineStart - (newlineAfter ? 1 : 0)));
+            newlineAfterLine.push_back(newlineAfter);
+            lineStart = lineEnd;
+        }
+    }
 
-                if (!newSelStartFound && (index >= textSelectionPositions.first))
-                {
-                    newSelStart = sf::Vector2<std::size_t>(m_lines[i].getSize() - (index - textSelectionPositions.first), i);
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-                    newSelStartFound = true;
-                    if (newSelEndFound)
-                        break;
-                }
+    void TextBox::rearrangeText(bool keepSelection)
+    {
+        if (m_document)
+        {
+            rearrangeDocument();
+            return;
+        }
 
-                if (!newSelEndFound && (index >= textSelectionPositions.second))
-                {
-                    newSelEnd = sf::Vector2<std::size_t>(m_lines[i].getSize() - (index - textSelectionPositions.second), i);
+        invalidate();
 
-                    newSelEndFound = true;
-                    if (newSelStartFound)
-                        break;
-                }
+        // Store the current selection position when we are keeping the selection
+        std::pair<std::size_t, std::size_t> textSelectionPositions;
+        if (keepSelection)
+            textSelectionPositions = findTextSelectionPositions();
 
-                // Skip newlines in the text
-                if (m_text[index] == '\n')
-                    ++index;
-            }
+        // Fit all paragraphs in the available space
+        std::vector<sf::String> lines;
+        std::vector<bool> newlineAfterLine;
+        wrapText(getText(), lines, newlineAfterLine);
+        m_lines = std::move(lines);
+        m_newlineAfterLine = std::move(newlineAfterLine);
 
-            // Keep the selection when possible
-            if (newSelStartFound && newSelEndFound)
-            {
-                m_selStart = newSelStart;
-                m_selEnd = newSelEnd;
-            }
-            else // The text has changed too much, the selection can't be kept
-            {
-                m_selStart = sf::Vector2<std::size_t>(m_lines[m_lines.size()-1].getSize(), m_lines.size()-1);
-                m_selEnd = m_selStart;
-            }
+        // Keep the selection when possible, otherwise set the caret at the back of the text
+        if (keepSelection)
+        {
+            m_selStart = findPosition(textSelectionPositions.first);
+            m_selEnd = findPosition(textSelectionPositions.second);
         }
-        else // Set the caret at the back of the text
+        else
         {
             m_selStart = sf::Vector2<std::size_t>(m_lines[m_lines.size()-1].getSize(), m_lines.size()-1);
             m_selEnd = m_selStart;
         }
 
+        // Don't continue when line height is 0 or when there is no font yet
+        if ((m_lineHeight == 0) || (m_fontCached == nullptr))
+            return;
+
         // Tell the scrollbar how many pixels the text contains
         const bool scrollbarShown = m_verticalScroll.isShown();
 
@@ -1159,16 +1301,144 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void TextBox::rearrangeDocument()
+    {
+        invalidate();
+
+        if ((m_lineHeight == 0) || (m_fontCached == nullptr))
+        {
+            m_documentTexts.clear();
+            return;
+        }
+
+        // Tell the scrollbar how many pixels the text contains, the number of lines is estimated while the file is being scanned.
+        // Once all lines are known, the rows of word-wrapped lines at the end of the file are included as well.
+        double textHeight;
+        if (m_document->isIndexComplete())
+            textHeight = findDocumentScrollEnd() + m_verticalScroll.getLowValue();
+        else
+            textHeight = static_cast<double>(m_document->getLineCount()) * m_lineHeight + Text::calculateExtraVerticalSpace(m_fontCached, m_textSize);
+
+        m_verticalScroll.setMaximum(static_cast<unsigned int>(std::min(textHeight, static_cast<double>(std::numeric_limits<unsigned int>::max()))));
+        m_verticalScroll.setPosition({getSize().x - m_bordersCached.getRight() - m_paddingCached.getRight() - m_verticalScroll.getSize().x, m_bordersCached.getTop() + m_paddingCached.getTop()});
+
+        updateDocumentTexts();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    double TextBox::findDocumentScrollEnd()
+    {
+        const float visibleHeight = static_cast<float>(m_verticalScroll.getLowValue());
+        const float maxLineWidth = std::max(0.f, getMaximumLineWidth());
+
+        // Add the heights of the lines, starting from the last one, until they fill the text box
+        float height = Text::calculateExtraVerticalSpace(m_fontCached, m_textSize);
+        sf::String line;
+        for (std::size_t i = m_document->getLineCount(); i > 0; --i)
+        {
+            if (!m_document->readLine(i - 1, line))
+                continue;
+
+            const sf::String wrappedLine = Text::wordWrap(maxLineWidth, line, m_fontCached, m_textSize, false, false);
+            height += (std::count(wrappedLine.begin(), wrappedLine.end(), '\n') + 1) * static_cast<float>(m_lineHeight);
+            if (height >= visibleHeight)
+            {
+                // The scrollbar can only hide part of the first row of the top line. When more of that line has to be hidden,
+                // the next line is placed at the top instead.
+                const float hiddenHeight = height - visibleHeight;
+                if (hiddenHeight < m_lineHeight)
+                    return static_cast<double>(i - 1) * m_lineHeight + hiddenHeight;
+                else
+                    return static_cast<double>(i) * m_lineHeight;
+            }
+        }
+
+        // The whole document fits inside the text box
+        return 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextBox::updateDocumentTexts()
+    {
+        invalidate();
+
+        m_documentTexts.clear();
+        if (!m_document || (m_lineHeight == 0) || (m_fontCached == nullptr))
+            return;
+
+        const float visibleHeight = getInnerSize().y - m_paddingCached.getTop() - m_paddingCached.getBottom();
+        const float maxLineWidth = std::max(0.f, getMaximumLineWidth());
+
+        // Only the lines that are visible are decoded, the first one may be partially scrolled out of view
+        float top = -static_cast<float>(m_verticalScroll.getValue() % m_lineHeight);
+        sf::String line;
+        for (std::size_t i = m_verticalScroll.getValue() / m_lineHeight; (top < visibleHeight) && m_document->readLine(i, line); ++i)
+        {
+            const sf::String wrappedLine = Text::wordWrap(maxLineWidth, line, m_fontCached, m_textSize, false, false);
+
+            Text text;
+            text.setFont(m_fontCached);
+            text.setCharacterSize(m_textSize);
+            text.setColor(m_textBeforeSelection.getColor());
+            text.setOpacity(m_opacityCached);
+            text.setString(wrappedLine);
+            text.setPosition(0, top);
+            m_documentTexts.push_back(std::move(text));
+
+            top += (std::count(wrappedLine.begin(), wrappedLine.end(), '\n') + 1) * static_cast<float>(m_lineHeight);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void TextBox::updateSelectionTexts()
     {
-        // If there is no selection then just put the whole text in m_textBeforeSelection
-        if (m_selStart == m_selEnd)
+        invalidate();
+
+        // Check if the caret is located above or below the view
+        if (isVerticalScrollbarPresent())
         {
-            sf::String displayedText;
-            for (std::size_t i = 0; i < m_lines.size(); ++i)
-                displayedText += m_lines[i] + "\n";
+            if (m_selEnd.y <= m_topLine)
+                m_verticalScroll.setValue(static_cast<unsigned int>(m_selEnd.y * m_lineHeight));
+            else if (m_selEnd.y + 1 >= m_topLine + m_visibleLines)
+                m_verticalScroll.setValue(static_cast<unsigned int>(((m_selEnd.y + 1) * m_lineHeight) + Text::calculateExtraVerticalSpace(m_fontCached, m_textSize) - m_verticalScroll.getLowValue()));
+        }
+
+        // Mark the texts as outdated, they are recreated for the lines that are visible now
+        m_textsLastLine = m_textsFirstLine;
+        recalculateVisibleLines();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextBox::updateVisibleTexts()
+    {
+        invalidate();
+
+        // Half a page of lines above and below the visible lines is also stored, so that scrolling a few lines is cheap
+        const std::size_t extraLines = m_visibleLines / 2 + 1;
+        m_textsLastLine = std::min(m_topLine + m_visibleLines + extraLines, m_lines.size());
+        m_textsFirstLine = std::min((m_topLine > extraLines) ? m_topLine - extraLines : 0, m_textsLastLine - 1);
+
+        const auto joinLines = [this](std::size_t firstLine, std::size_t lastLine)
+            {
+                sf::String string;
+                for (std::size_t i = firstLine; i < lastLine; ++i)
+                    string += m_lines[i] + "\n";
 
-            m_textBeforeSelection.setString(displayedText);
+                return string;
+            };
+
+        const auto visibleSelection = findVisibleSelection();
+        const auto& selectionStart = visibleSelection.first;
+        const auto& selectionEnd = visibleSelection.second;
+
+        // If there is no selection then just put the whole text in m_textBeforeSelection
+        if (selectionStart == selectionEnd)
+        {
+            m_textBeforeSelection.setString(joinLines(m_textsFirstLine, m_textsLastLine));
             m_textSelection1.setString("");
             m_textSelection2.setString("");
             m_textAfterSelection1.setString("");
@@ -1176,66 +1446,52 @@ namespace tgui
         }
         else // Some text is selected
         {
-            auto selectionStart = m_selStart;
-            auto selectionEnd = m_selEnd;
-
-            if ((m_selStart.y > m_selEnd.y) || ((m_selStart.y == m_selEnd.y) && (m_selStart.x > m_selEnd.x)))
-                std::swap(selectionStart, selectionEnd);
-
             // Set the text before the selection
-            if (selectionStart.y > 0)
-            {
-                sf::String string;
-                for (std::size_t i = 0; i < selectionStart.y; ++i)
-                    string += m_lines[i] + "\n";
-
-                string += m_lines[selectionStart.y].substring(0, selectionStart.x);
-                m_textBeforeSelection.setString(string);
-            }
-            else
-                m_textBeforeSelection.setString(m_lines[0].substring(0, selectionStart.x));
+            m_textBeforeSelection.setString(joinLines(m_textsFirstLine, selectionStart.y) + m_lines[selectionStart.y].substring(0, selectionStart.x));
 
             // Set the selected text
-            if (m_selStart.y == m_selEnd.y)
+            if (selectionStart.y == selectionEnd.y)
             {
                 m_textSelection1.setString(m_lines[selectionStart.y].substring(selectionStart.x, selectionEnd.x - selectionStart.x));
                 m_textSelection2.setString("");
             }
             else
             {
-                m_textSelection1.setString(m_lines[selectionStart.y].substring(selectionStart.x, m_lines[selectionStart.y].getSize() - selectionStart.x));
+                m_textSelection1.setString(m_lines[selectionStart.y].substring(selectionStart.x));
+                m_textSelection2.setString(joinLines(selectionStart.y + 1, selectionEnd.y) + m_lines[selectionEnd.y].substring(0, selectionEnd.x));
+            }
 
-                sf::String string;
-                for (std::size_t i = selectionStart.y + 1; i < selectionEnd.y; ++i)
-                    string += m_lines[i] + "\n";
+            // Set the text after the selection
+            m_textAfterSelection1.setString(m_lines[selectionEnd.y].substring(selectionEnd.x));
+            m_textAfterSelection2.setString(joinLines(selectionEnd.y + 1, m_textsLastLine));
+        }
 
-                string += m_lines[selectionEnd.y].substring(0, selectionEnd.x);
+        recalculatePositions();
+    }
 
-                m_textSelection2.setString(string);
-            }
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-            // Set the text after the selection
-            {
-                m_textAfterSelection1.setString(m_lines[selectionEnd.y].substring(selectionEnd.x, m_lines[selectionEnd.y].getSize() - selectionEnd.x));
+    std::pair<sf::Vector2<std::size_t>, sf::Vector2<std::size_t>> TextBox::findVisibleSelection() const
+    {
+        auto selectionStart = m_selStart;
+        auto selectionEnd = m_selEnd;
 
-                sf::String string;
-                for (std::size_t i = selectionEnd.y + 1; i < m_lines.size(); ++i)
-                    string += m_lines[i] + "\n";
+        if ((m_selStart.y > m_selEnd.y) || ((m_selStart.y == m_selEnd.y) && (m_selStart.x > m_selEnd.x)))
+            std::swap(selectionStart, selectionEnd);
 
-                m_textAfterSelection2.setString(string);
-            }
-        }
+        const sf::Vector2<std::size_t> firstPosition{0, m_textsFirstLine};
+        const sf::Vector2<std::size_t> lastPosition{m_lines[m_textsLastLine - 1].getSize(), m_textsLastLine - 1};
 
-        // Check if the caret is located above or below the view
-        if (isVerticalScrollbarPresent())
-        {
-            if (m_selEnd.y <= m_topLine)
-                m_verticalScroll.setValue(static_cast<unsigned int>(m_selEnd.y * m_lineHeight));
-            else if (m_selEnd.y + 1 >= m_topLine + m_visibleLines)
-                m_verticalScroll.setValue(static_cast<unsigned int>(((m_selEnd.y + 1) * m_lineHeight) + Text::calculateExtraVerticalSpace(m_fontCached, m_textSize) - m_verticalScroll.getLowValue()));
-        }
+        if (selectionStart.y < firstPosition.y)
+            selectionStart = firstPosition;
+        if (selectionEnd.y > lastPosition.y)
+            selectionEnd = lastPosition;
 
-        recalculatePositions();
+        // Check if the selection lies completely outside the stored lines
+        if ((selectionStart.y > selectionEnd.y) || ((selectionStart.y == selectionEnd.y) && (selectionStart.x >= selectionEnd.x)))
+            return {firstPosition, firstPosition};
+
+        return {selectionStart, selectionEnd};
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1248,6 +1504,17 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    float TextBox::getMaximumLineWidth() const
+    {
+        float maxLineWidth = getInnerSize().x - m_paddingCached.getLeft() - m_paddingCached.getRight();
+        if (m_verticalScroll.isShown())
+            maxLineWidth -= m_verticalScroll.getSize().x;
+
+        return maxLineWidth;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void TextBox::update(sf::Time elapsedTime)
     {
         Widget::update(elapsedTime);
@@ -1261,9 +1528,37 @@ namespace tgui
             // Switch the value of the visible flag
             m_caretVisible = !m_caretVisible;
 
+            // The caret is only drawn while the widget is focused
+            if (m_focused)
+                invalidate();
+
             // Too slow for double clicking
             m_possibleDoubleClick = false;
         }
+
+        // Continue scanning the document, the scrollbar is updated while more lines are being found
+        if (m_document && !m_document->isIndexComplete())
+        {
+            m_document->buildIndex(4 * 1024 * 1024);
+            rearrangeDocument();
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::Time TextBox::timeUntilNextUpdate() const
+    {
+        const sf::Time time = Widget::timeUntilNextUpdate();
+
+        // The document is scanned during the updates
+        if (m_document && !m_document->isIndexComplete())
+            return sf::Time::Zero;
+
+        if (!m_focused)
+            return time;
+
+        // The caret is shown or hidden every half second
+        return std::min(time, std::max(sf::Time::Zero, sf::milliseconds(500) - m_animationTimeElapsed));
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1288,14 +1583,14 @@ namespace tgui
 
         // Calculate the position of the text objects
         m_selectionRects.clear();
-        m_textBeforeSelection.setPosition({0, 0});
-        if (m_selStart != m_selEnd)
-        {
-            auto selectionStart = m_selStart;
-            auto selectionEnd = m_selEnd;
+        m_textBeforeSelection.setPosition({0, static_cast<float>(m_textsFirstLine * m_lineHeight)});
 
-            if ((m_selStart.y > m_selEnd.y) || ((m_selStart.y == m_selEnd.y) && (m_selStart.x > m_selEnd.x)))
-                std::swap(selectionStart, selectionEnd);
+        // Only the selection rectangles on the stored lines are created
+        const auto visibleSelection = findVisibleSelection();
+        if (visibleSelection.first != visibleSelection.second)
+        {
+            const auto& selectionStart = visibleSelection.first;
+            const auto& selectionEnd = visibleSelection.second;
 
             float kerningSelectionStart = 0;
             if ((selectionStart.x > 0) && (selectionStart.x < m_lines[selectionStart.y].getSize()))
@@ -1308,10 +1603,10 @@ namespace tgui
             if (selectionStart.x > 0)
             {
                 m_textSelection1.setPosition({m_textBeforeSelection.findCharacterPos(m_textBeforeSelection.getString().getSize()).x + kerningSelectionStart,
-                                              m_textBeforeSelection.getPosition().y + (selectionStart.y * m_lineHeight)});
+                                              static_cast<float>(selectionStart.y * m_lineHeight)});
             }
             else
-                m_textSelection1.setPosition({0, m_textBeforeSelection.getPosition().y + (selectionStart.y * m_lineHeight)});
+                m_textSelection1.setPosition({0, static_cast<float>(selectionStart.y * m_lineHeight)});
 
             m_textSelection2.setPosition({0, static_cast<float>((selectionStart.y + 1) * m_lineHeight)});
 
@@ -1364,14 +1659,18 @@ namespace tgui
                 }
             }
         }
-
-        recalculateVisibleLines();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void TextBox::recalculateVisibleLines()
     {
+        if (m_document)
+        {
+            updateDocumentTexts();
+            return;
+        }
+
         m_visibleLines = std::min(static_cast<std::size_t>((getInnerSize().y - m_paddingCached.getTop() - m_paddingCached.getBottom()) / m_lineHeight), m_lines.size());
 
         // Store which area is visible
@@ -1390,6 +1689,13 @@ namespace tgui
             m_topLine = 0;
             m_visibleLines = std::min(static_cast<std::size_t>((getInnerSize().y - m_paddingCached.getTop() - m_paddingCached.getBottom()) / m_lineHeight), m_lines.size());
         }
+
+        // Only the lines near the visible ones are stored in the text objects, they are recreated when scrolling past them
+        if ((m_textsFirstLine == m_textsLastLine) || (m_topLine < m_textsFirstLine)
+         || (std::min(m_topLine + m_visibleLines, m_lines.size()) > m_textsLastLine))
+        {
+            updateVisibleTexts();
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1421,6 +1727,9 @@ namespace tgui
             m_textBeforeSelection.setColor(getRenderer()->getTextColor());
             m_textAfterSelection1.setColor(getRenderer()->getTextColor());
             m_textAfterSelection2.setColor(getRenderer()->getTextColor());
+
+            if (m_document)
+                updateDocumentTexts();
         }
         else if (property == "selectedtextcolor")
         {
@@ -1466,6 +1775,9 @@ namespace tgui
             m_textAfterSelection2.setOpacity(m_opacityCached);
             m_textSelection1.setOpacity(m_opacityCached);
             m_textSelection2.setOpacity(m_opacityCached);
+
+            for (auto& text : m_documentTexts)
+                text.setOpacity(m_opacityCached);
         }
         else if (property == "font")
         {
@@ -1506,40 +1818,19 @@ namespace tgui
         {
             states.transform.translate({m_paddingCached.getLeft(), m_paddingCached.getTop()});
 
-            float maxLineWidth = getInnerSize().x - m_paddingCached.getLeft() - m_paddingCached.getRight();
-            if (m_verticalScroll.isShown())
-                maxLineWidth -= m_verticalScroll.getSize().x;
+            const float maxLineWidth = getMaximumLineWidth();
 
             // Set the clipping for all draw calls that happen until this clipping object goes out of scope
             const Clipping clipping{target, states, {}, {maxLineWidth, getInnerSize().y - m_paddingCached.getTop() - m_paddingCached.getBottom()}};
 
-            // Move the text according to the vertical scrollar
-            states.transform.translate({0, -static_cast<float>(m_verticalScroll.getValue())});
-
-            // Draw the background of the selected text
-            for (const auto& selectionRect : m_selectionRects)
+            // The lines of a document are already positioned relative to the top of the visible area
+            if (m_document)
             {
-                states.transform.translate({selectionRect.left, selectionRect.top});
-                drawRectangleShape(target, states, {selectionRect.width, selectionRect.height}, m_selectedTextBackgroundColorCached);
-                states.transform.translate({-selectionRect.left, -selectionRect.top});
-            }
-
-            // Draw the text
-            m_textBeforeSelection.draw(target, states);
-            if (m_selStart != m_selEnd)
-            {
-                m_textSelection1.draw(target, states);
-                m_textSelection2.draw(target, states);
-                m_textAfterSelection1.draw(target, states);
-                m_textAfterSelection2.draw(target, states);
-            }
-
-            // Only draw the caret when needed
-            if (m_focused && m_caretVisible && (m_caretWidthCached > 0))
-            {
-                states.transform.translate({std::ceil(m_caretPosition.x - (m_caretWidthCached / 2.f)), m_caretPosition.y});
-                drawRectangleShape(target, states, {m_caretWidthCached, static_cast<float>(m_lineHeight)}, m_caretColorCached);
+                for (const auto& text : m_documentTexts)
+                    text.draw(target, states);
             }
+            else
+                drawText(target, states);
         }
 
         // Draw the scrollbar if needed
@@ -1548,6 +1839,39 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextBox::drawText(sf::RenderTarget& target, sf::RenderStates states) const
+    {
+        // Move the text according to the vertical scrollar
+        states.transform.translate({0, -static_cast<float>(m_verticalScroll.getValue())});
+
+        // Draw the background of the selected text
+        for (const auto& selectionRect : m_selectionRects)
+        {
+            states.transform.translate({selectionRect.left, selectionRect.top});
+            drawRectangleShape(target, states, {selectionRect.width, selectionRect.height}, m_selectedTextBackgroundColorCached);
+            states.transform.translate({-selectionRect.left, -selectionRect.top});
+        }
+
+        // Draw the text
+        m_textBeforeSelection.draw(target, states);
+        if (m_selStart != m_selEnd)
+        {
+            m_textSelection1.draw(target, states);
+            m_textSelection2.draw(target, states);
+            m_textAfterSelection1.draw(target, states);
+            m_textAfterSelection2.draw(target, states);
+        }
+
+        // Only draw the caret when needed
+        if (m_focused && m_caretVisible && (m_caretWidthCached > 0))
+        {
+            states.transform.translate({std::ceil(m_caretPosition.x - (m_caretWidthCached / 2.f)), m_caretPosition.y});
+            drawRectangleShape(target, states, {m_caretWidthCached, static_cast<float>(m_lineHeight)}, m_caretColorCached);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -28,28 +28,98 @@
 
 TEST_CASE("[Clipping]")
 {
-    auto panel = tgui::Panel::create({40, 30});
-    panel->setPosition(395, 305);
-    panel->getRenderer()->setBackgroundColor(sf::Color::Green);
-
-    auto clippedPanel = tgui::Panel::create({200, 200});
-    clippedPanel->setPosition(-50, -50);
-    clippedPanel->getRenderer()->setBackgroundColor({255, 0, 0, 100});
-    panel->add(clippedPanel);
-
-    TEST_DRAW_INIT(80, 80, panel)
-
-    auto background = tgui::Panel::create();
-    background->setSize({800, 600});
-    background->getRenderer()->setBackgroundColor(sf::Color::Blue);
-    gui.add(background);
-    background->moveToBack();
-
-    sf::View view = gui.getView();
-    view.setViewport({0.1f, 0.2f, 0.8f, 0.6f});
-    view.setCenter(415, 320);
-    view.setSize(80, 40);
-    gui.setView(view);
-
-    TEST_DRAW("Clipping.png")
+    SECTION("isVisible")
+    {
+        sf::RenderTexture target;
+        target.create(100, 100);
+
+        REQUIRE(tgui::Clipping::isVisible(target, {}, {10, 10, 20, 20}));
+        REQUIRE(tgui::Clipping::isVisible(target, {}, {-10, -10, 20, 20}));
+        REQUIRE(!tgui::Clipping::isVisible(target, {}, {-30, 10, 20, 20}));
+        REQUIRE(!tgui::Clipping::isVisible(target, {}, {10, 110, 20, 20}));
+
+        sf::RenderStates states;
+        states.transform.translate({-100, 0});
+        REQUIRE(!tgui::Clipping::isVisible(target, states, {10, 10, 20, 20}));
+        REQUIRE(tgui::Clipping::isVisible(target, states, {110, 10, 20, 20}));
+
+        {
+            const tgui::Clipping clipping{target, {}, {40, 40}, {20, 20}};
+            REQUIRE(tgui::Clipping::isVisible(target, {}, {30, 30, 20, 20}));
+            REQUIRE(!tgui::Clipping::isVisible(target, {}, {10, 10, 20, 20}));
+            REQUIRE(!tgui::Clipping::isVisible(target, {}, {70, 40, 20, 20}));
+
+            // The clipping area only applies to the target on which it was created
+            sf::RenderTexture otherTarget;
+            otherTarget.create(100, 100);
+            REQUIRE(tgui::Clipping::isVisible(otherTarget, {}, {10, 10, 20, 20}));
+        }
+
+        REQUIRE(tgui::Clipping::isVisible(target, {}, {10, 10, 20, 20}));
+    }
+
+    SECTION("ClippingStack")
+    {
+        sf::RenderTexture target;
+        target.create(100, 100);
+        target.setActive(true);
+
+        REQUIRE(tgui::ClippingStack::getActive(target) == nullptr);
+
+        tgui::ClippingStack stack;
+        stack.begin(target);
+        REQUIRE(tgui::ClippingStack::getActive(target) == &stack);
+        REQUIRE(stack.getArea() == sf::IntRect(0, 0, 100, 100));
+
+        {
+            const tgui::Clipping clipping{target, {}, {10, 20}, {50, 60}};
+            REQUIRE(stack.getArea() == sf::IntRect(10, 20, 50, 60));
+
+            {
+                const tgui::Clipping innerClipping{target, {}, {40, 0}, {100, 30}};
+                REQUIRE(stack.getArea() == sf::IntRect(40, 20, 20, 10));
+            }
+
+            {
+                const tgui::Clipping innerClipping{target, {}, {70, 0}, {10, 10}};
+                REQUIRE(stack.getArea().width == 0);
+                REQUIRE(stack.getArea().height == 0);
+            }
+
+            REQUIRE(stack.getArea() == sf::IntRect(10, 20, 50, 60));
+        }
+
+        REQUIRE(stack.getArea() == sf::IntRect(0, 0, 100, 100));
+
+        stack.end();
+        REQUIRE(tgui::ClippingStack::getActive(target) == nullptr);
+    }
+
+    SECTION("Draw")
+    {
+        auto panel = tgui::Panel::create({40, 30});
+        panel->setPosition(395, 305);
+        panel->getRenderer()->setBackgroundColor(sf::Color::Green);
+
+        auto clippedPanel = tgui::Panel::create({200, 200});
+        clippedPanel->setPosition(-50, -50);
+        clippedPanel->getRenderer()->setBackgroundColor({255, 0, 0, 100});
+        panel->add(clippedPanel);
+
+        TEST_DRAW_INIT(80, 80, panel)
+
+        auto background = tgui::Panel::create();
+        background->setSize({800, 600});
+        background->getRenderer()->setBackgroundColor(sf::Color::Blue);
+        gui.add(background);
+        background->moveToBack();
+
+        sf::View view = gui.getView();
+        view.setViewport({0.1f, 0.2f, 0.8f, 0.6f});
+        view.setCenter(415, 320);
+        view.setSize(80, 40);
+        gui.setView(view);
+
+        TEST_DRAW("Clipping.png")
+    }
 }
@@ -128,6 +128,94 @@ TEST_CASE("[Container]")
             // Removing the found indirect child means that there is no more widget with that name
             child1->remove(child4);
             REQUIRE(container->get("name") == nullptr);
+
+            // Inserting a widget in front of another one in a layout changes which one is found
+            auto layout = tgui::VerticalLayout::create();
+            auto item1 = tgui::Label::create();
+            auto item2 = tgui::Label::create();
+            container->add(layout);
+            layout->add(item1, "item");
+            layout->insert(0, item2, "item");
+            REQUIRE(container->get("item") == item2);
+        }
+
+        SECTION("nested containers")
+        {
+            container->removeAllWidgets();
+
+            auto settings = tgui::Panel::create();
+            auto audio = tgui::Panel::create();
+            auto volume = tgui::Slider::create();
+            audio->add(volume, "Volume");
+            settings->add(audio, "Audio");
+
+            // Widgets that were inside a container before it was added can be found as well
+            container->add(settings, "SettingsPanel");
+            REQUIRE(container->get("Volume") == volume);
+            REQUIRE(settings->get("Volume") == volume);
+
+            REQUIRE(container->get("SettingsPanel.Audio.Volume") == volume);
+            REQUIRE(container->get("Audio.Volume") == volume);
+            REQUIRE(settings->get("Audio.Volume") == volume);
+            REQUIRE(container->get("SettingsPanel.Audio") == audio);
+            REQUIRE(container->get("SettingsPanel.Volume") == nullptr);
+            REQUIRE(container->get("SettingsPanel.Audio.Volume.Other") == nullptr);
+            REQUIRE(container->get("SettingsPanel..Audio") == nullptr);
+            REQUIRE(container->get("SettingsPanel.") == nullptr);
+
+            // A widget whose name contains a dot is found before the name is treated as a path
+            auto dotted = tgui::Panel::create();
+            container->add(dotted, "SettingsPanel.Audio");
+            REQUIRE(container->get("SettingsPanel.Audio") == dotted);
+            container->remove(dotted);
+
+            // Renaming and removing widgets updates the names known by all parents
+            REQUIRE(audio->setWidgetName(volume, "Loudness"));
+            REQUIRE(container->get("Volume") == nullptr);
+            REQUIRE(container->get("SettingsPanel.Audio.Loudness") == volume);
+
+            settings->remove(audio);
+            REQUIRE(container->get("Loudness") == nullptr);
+            REQUIRE(container->get("Audio") == nullptr);
+            REQUIRE(audio->get("Loudness") == volume);
+
+            settings->add(audio, "Audio");
+            REQUIRE(container->get("Loudness") == volume);
+            container->removeAllWidgets();
+            REQUIRE(container->get("Loudness") == nullptr);
+            REQUIRE(settings->get("Loudness") == volume);
+        }
+
+        SECTION("assigning containers")
+        {
+            auto source = tgui::Panel::create();
+            source->add(tgui::Label::create(), "NewChild");
+
+            // Copying into a panel inside the gui replaces the names of its widgets in the gui as well
+            *widget2 = *source;
+            REQUIRE(container->get("w4") == nullptr);
+            REQUIRE(container->get("w5") == nullptr);
+            REQUIRE(container->get("NewChild") != nullptr);
+            REQUIRE(container->get("NewChild") == widget2->get("NewChild"));
+            REQUIRE(container->get("w2.NewChild") == widget2->get("NewChild"));
+
+            // Moving a panel takes the names of its widgets away from its own parents
+            auto otherPanel = tgui::Panel::create();
+            auto movedChild = tgui::Label::create();
+            otherPanel->add(movedChild, "Moved");
+            container->add(otherPanel, "Other");
+            REQUIRE(container->get("Moved") == movedChild);
+
+            *widget2 = std::move(*otherPanel);
+            REQUIRE(container->get("NewChild") == nullptr);
+            REQUIRE(container->get("Moved") == movedChild);
+            REQUIRE(container->get("w2.Moved") == movedChild);
+            REQUIRE(container->get("Other.Moved") == nullptr);
+            REQUIRE(otherPanel->getWidgets().empty());
+
+            tgui::Panel movedPanel{std::move(*widget2)};
+            REQUIRE(container->get("Moved") == nullptr);
+            REQUIRE(movedPanel.get("Moved") == movedChild);
         }
     }
 
@@ -264,6 +352,183 @@ TEST_CASE("[Container]")
         REQUIRE(widget5->getRenderer()->getOpacity() == 0.7f);
     }
 
+    SECTION("layer cache")
+    {
+        REQUIRE(!widget2->isLayerCached());
+        widget2->setLayerCached(true);
+        REQUIRE(widget2->isLayerCached());
+        widget2->setLayerCached(false);
+        REQUIRE(!widget2->isLayerCached());
+
+        sf::RenderTexture target;
+        target.create(100, 80);
+        tgui::Gui gui{target};
+
+        auto panel = tgui::Panel::create({80, 60});
+        panel->setPosition(10, 10);
+        panel->getRenderer()->setBackgroundColor(sf::Color::Blue);
+        gui.add(panel);
+
+        auto label = tgui::Label::create("Text");
+        label->setPosition(-5, 20);
+        panel->add(label);
+
+        auto drawToImage = [&]{
+                target.clear({25, 130, 10});
+                gui.draw();
+                target.display();
+                return target.getTexture().copyToImage();
+            };
+
+        const sf::Image uncachedImage = drawToImage();
+
+        // The cached layer has to be updated when a child changes
+        panel->setLayerCached(true);
+        label->setText("Other");
+        drawToImage();
+        label->setText("Text");
+        const sf::Image cachedImage = drawToImage();
+
+        REQUIRE(uncachedImage.getSize() == cachedImage.getSize());
+        for (unsigned int y = 0; y < cachedImage.getSize().y; ++y)
+        {
+            for (unsigned int x = 0; x < cachedImage.getSize().x; ++x)
+            {
+                // Blending the layer separately may cause rounding differences on partially transparent pixels
+                const sf::Color uncachedPixel = uncachedImage.getPixel(x, y);
+                const sf::Color cachedPixel = cachedImage.getPixel(x, y);
+                REQUIRE(std::abs(uncachedPixel.r - cachedPixel.r) <= 2);
+                REQUIRE(std::abs(uncachedPixel.g - cachedPixel.g) <= 2);
+                REQUIRE(std::abs(uncachedPixel.b - cachedPixel.b) <= 2);
+            }
+        }
+
+        // Moving the mouse over a child that doesn't change when hovered leaves the layer valid
+        sf::Event event;
+        event.type = sf::Event::MouseMoved;
+        event.mouseMove = {20, 35};
+        gui.handleEvent(event);
+        drawToImage();
+        REQUIRE(!gui.needsRedraw());
+
+        event.mouseMove = {22, 36};
+        gui.handleEvent(event);
+        REQUIRE(!gui.needsRedraw());
+
+        // Leaving the child does change it
+        event.mouseMove = {60, 60};
+        gui.handleEvent(event);
+        REQUIRE(gui.needsRedraw());
+    }
+
+    SECTION("mouse on widget with many widgets")
+    {
+        auto parent = tgui::Group::create({300, 300});
+
+        tgui::Widget::Ptr pressedWidget;
+        auto addWidget = [&](sf::Vector2f pos, sf::Vector2f size){
+                auto widget = tgui::ClickableWidget::create(size);
+                widget->setPosition(pos);
+                widget->onMousePress.connect([&pressedWidget](tgui::Widget::Ptr w, std::string){ pressedWidget = w; });
+                parent->add(widget);
+                return widget;
+            };
+
+        auto widgetAt = [&](sf::Vector2f pos){
+                pressedWidget = nullptr;
+                parent->leftMousePressed(pos);
+                parent->leftMouseReleased(pos);
+                return pressedWidget;
+            };
+
+        std::vector<tgui::ClickableWidget::Ptr> widgets;
+        for (unsigned int i = 0; i < 100; ++i)
+            widgets.push_back(addWidget({(i % 10) * 20.f, (i / 10) * 20.f}, {20, 20}));
+
+        REQUIRE(widgetAt({5, 5}) == widgets[0]);
+        REQUIRE(widgetAt({45, 25}) == widgets[12]);
+        REQUIRE(widgetAt({195, 195}) == widgets[99]);
+        REQUIRE(widgetAt({250, 50}) == nullptr);
+
+        // Widgets in front are found first
+        auto front = addWidget({35, 35}, {30, 30});
+        REQUIRE(widgetAt({50, 50}) == front);
+        parent->moveWidgetToBack(front);
+        REQUIRE(widgetAt({50, 50}) == widgets[22]);
+        parent->moveWidgetToFront(front);
+        REQUIRE(widgetAt({50, 50}) == front);
+
+        // Moving and resizing widgets, also outside the area of the other widgets
+        front->setPosition(150, 10);
+        REQUIRE(widgetAt({50, 50}) == widgets[22]);
+        REQUIRE(widgetAt({160, 20}) == front);
+        front->setSize(100, 100);
+        REQUIRE(widgetAt({240, 100}) == front);
+
+        // Hidden, disabled and removed widgets
+        front->hide();
+        REQUIRE(widgetAt({160, 20}) == widgets[18]);
+        widgets[18]->disable();
+        REQUIRE(widgetAt({160, 20}) == nullptr);
+        parent->remove(widgets[18]);
+        front->show();
+        REQUIRE(widgetAt({160, 20}) == front);
+        front->hide();
+        REQUIRE(widgetAt({160, 20}) == nullptr);
+        REQUIRE(widgetAt({180, 20}) == widgets[19]);
+    }
+
+    SECTION("mouse capture")
+    {
+        auto parent = tgui::Group::create({300, 300});
+        auto inner = tgui::Group::create({100, 100});
+        inner->setPosition(100, 100);
+        parent->add(inner);
+
+        auto clickable = tgui::ClickableWidget::create({50, 50});
+        inner->add(clickable);
+
+        auto slider = tgui::Slider::create(0, 10);
+        slider->setPosition(0, 60);
+        slider->setSize(100, 10);
+        inner->add(slider);
+
+        unsigned int clickCount = 0;
+        clickable->onClick.connect([&]{ ++clickCount; });
+
+        // The parent of the container passes the release to the widgets on which the mouse went down
+        auto releaseMouse = [&](sf::Vector2f pos){
+                parent->leftMouseReleased(pos);
+                parent->mouseNoLongerDown();
+            };
+
+        parent->leftMousePressed({110, 110});
+        releaseMouse({110, 110});
+        REQUIRE(clickCount == 1);
+
+        // Releasing somewhere else ends the press, so releasing on the widget later is not a click
+        parent->leftMousePressed({110, 110});
+        releaseMouse({250, 250});
+        parent->leftMouseReleased({110, 110});
+        REQUIRE(clickCount == 1);
+
+        // Mouse moves reach the dragged widget through its parents, even when the mouse leaves them
+        parent->leftMousePressed({150, 165});
+        parent->mouseMoved({290, 165});
+        REQUIRE(slider->getValue() == 10);
+        releaseMouse({290, 165});
+
+        parent->mouseMoved({100, 165});
+        REQUIRE(slider->getValue() == 10);
+
+        // A widget that is removed while the mouse is down no longer receives events
+        parent->leftMousePressed({150, 165});
+        inner->remove(slider);
+        parent->mouseMoved({100, 165});
+        releaseMouse({100, 165});
+        REQUIRE(slider->getValue() == 5);
+    }
+
     // TODO: Events
     //       Test parameter of Widget::disable
 }
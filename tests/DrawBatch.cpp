@@ -0,0 +1,106 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "Tests.hpp"
+#include <TGUI/DrawBatch.hpp>
+#include <TGUI/Gui.hpp>
+#include <TGUI/Widgets/Button.hpp>
+#include <TGUI/Widgets/Panel.hpp>
+#include <TGUI/Widgets/Picture.hpp>
+
+TEST_CASE("[DrawBatch]")
+{
+    sf::RenderTexture target;
+    target.create(100, 100);
+
+    SECTION("Active target")
+    {
+        sf::RenderTexture otherTarget;
+        otherTarget.create(10, 10);
+
+        REQUIRE(!tgui::DrawBatch::isBatching(target));
+        {
+            tgui::DrawBatch batch{target};
+            REQUIRE(tgui::DrawBatch::isBatching(target));
+            REQUIRE(!tgui::DrawBatch::isBatching(otherTarget));
+
+            {
+                tgui::DrawBatch innerBatch{otherTarget};
+                REQUIRE(!tgui::DrawBatch::isBatching(target));
+                REQUIRE(tgui::DrawBatch::isBatching(otherTarget));
+            }
+
+            REQUIRE(tgui::DrawBatch::isBatching(target));
+        }
+        REQUIRE(!tgui::DrawBatch::isBatching(target));
+    }
+
+    SECTION("Gui")
+    {
+        tgui::Gui gui{target};
+        REQUIRE(!gui.isDrawBatchingEnabled());
+        gui.setDrawBatching(true);
+        REQUIRE(gui.isDrawBatchingEnabled());
+        gui.setDrawBatching(false);
+        REQUIRE(!gui.isDrawBatchingEnabled());
+    }
+
+    SECTION("Same result as without batching")
+    {
+        tgui::Gui gui{target};
+
+        auto panel = tgui::Panel::create({80, 60});
+        panel->setPosition(10, 10);
+        panel->getRenderer()->setBackgroundColor(sf::Color::Blue);
+        gui.add(panel);
+
+        auto button = tgui::Button::create("Hello");
+        button->setPosition(-5, 20);
+        button->setSize(50, 25);
+        panel->add(button);
+
+        auto picture = tgui::Picture::create("resources/image.png");
+        picture->setPosition(50, 40);
+        gui.add(picture);
+
+        target.clear({25, 130, 10});
+        gui.draw();
+        target.display();
+        const sf::Image unbatchedImage = target.getTexture().copyToImage();
+
+        gui.setDrawBatching(true);
+        target.clear({25, 130, 10});
+        gui.draw();
+        target.display();
+        const sf::Image batchedImage = target.getTexture().copyToImage();
+
+        REQUIRE(unbatchedImage.getSize() == batchedImage.getSize());
+        for (unsigned int y = 0; y < batchedImage.getSize().y; ++y)
+        {
+            for (unsigned int x = 0; x < batchedImage.getSize().x; ++x)
+                REQUIRE(unbatchedImage.getPixel(x, y) == batchedImage.getPixel(x, y));
+        }
+    }
+}
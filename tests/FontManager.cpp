@@ -0,0 +1,74 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include "Tests.hpp"
+#include <TGUI/FontManager.hpp>
+
+TEST_CASE("[FontManager]")
+{
+    SECTION("normalizePath")
+    {
+        REQUIRE(tgui::FontManager::normalizePath("resources/DejaVuSans.ttf") == "resources/DejaVuSans.ttf");
+        REQUIRE(tgui::FontManager::normalizePath("./resources//DejaVuSans.ttf") == "resources/DejaVuSans.ttf");
+        REQUIRE(tgui::FontManager::normalizePath("resources\\fonts\\..\\DejaVuSans.ttf") == "resources/DejaVuSans.ttf");
+        REQUIRE(tgui::FontManager::normalizePath("../../a/./b.ttf") == "../../a/b.ttf");
+        REQUIRE(tgui::FontManager::normalizePath("/../usr/share/b.ttf") == "/usr/share/b.ttf");
+        REQUIRE(tgui::FontManager::normalizePath("C:\\..\\b.ttf") == "C:/b.ttf");
+    }
+
+    SECTION("Fonts are shared")
+    {
+        auto font1 = tgui::FontManager::getFont("resources/DejaVuSans.ttf");
+        auto font2 = tgui::FontManager::getFont("./resources/../resources/DejaVuSans.ttf");
+        REQUIRE(font1 != nullptr);
+        REQUIRE(font1 == font2);
+
+        // The font is released when nobody uses it anymore
+        std::weak_ptr<sf::Font> weakFont = font1;
+        font1 = nullptr;
+        font2 = nullptr;
+        REQUIRE(weakFont.expired());
+    }
+
+    SECTION("Failed loading")
+    {
+        REQUIRE(tgui::FontManager::getFont("resources/NonExistentFont.ttf") == nullptr);
+    }
+
+    SECTION("Memory mapping")
+    {
+        REQUIRE(!tgui::FontManager::isMemoryMappingEnabled());
+        tgui::FontManager::setMemoryMappingEnabled(true);
+        REQUIRE(tgui::FontManager::isMemoryMappingEnabled());
+
+        auto font = tgui::FontManager::getFont("resources/DejaVuSans.ttf");
+        REQUIRE(font != nullptr);
+        REQUIRE(font->getGlyph('A', 20, false).advance > 0);
+        REQUIRE(tgui::FontManager::getFont("resources/DejaVuSans.ttf") == font);
+
+        tgui::FontManager::setMemoryMappingEnabled(false);
+    }
+}
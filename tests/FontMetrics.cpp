@@ -0,0 +1,97 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include "Tests.hpp"
+#include <TGUI/FontMetrics.hpp>
+#include <TGUI/Text.hpp>
+
+TEST_CASE("[FontMetrics]")
+{
+    auto font = std::make_shared<sf::Font>();
+    REQUIRE(font->loadFromFile("resources/DejaVuSans.ttf"));
+
+    SECTION("Cached per character size and style")
+    {
+        REQUIRE(&tgui::FontMetrics::get(font, 20, false) == &tgui::FontMetrics::get(font, 20, false));
+        REQUIRE(&tgui::FontMetrics::get(font, 20, false) != &tgui::FontMetrics::get(font, 21, false));
+        REQUIRE(&tgui::FontMetrics::get(font, 20, false) != &tgui::FontMetrics::get(font, 20, true));
+
+        auto otherFont = std::make_shared<sf::Font>(*font);
+        REQUIRE(&tgui::FontMetrics::get(font, 20, false) != &tgui::FontMetrics::get(otherFont, 20, false));
+    }
+
+    SECTION("Same values as font")
+    {
+        for (const bool bold : {false, true})
+        {
+            const tgui::FontMetrics& metrics = tgui::FontMetrics::get(font, 18, bold);
+            REQUIRE(metrics.getLineSpacing() == font->getLineSpacing(18));
+
+            for (const sf::Uint32 codePoint : {sf::Uint32('A'), sf::Uint32('g'), sf::Uint32(' '), sf::Uint32(0xE9), sf::Uint32(0x3A9)})
+            {
+                REQUIRE(metrics.getAdvance(codePoint) == font->getGlyph(codePoint, 18, bold).advance);
+
+                // The second time the value comes from the cache
+                REQUIRE(metrics.getAdvance(codePoint) == font->getGlyph(codePoint, 18, bold).advance);
+            }
+
+            REQUIRE(metrics.getKerning('A', 'V') == font->getKerning('A', 'V', 18));
+            REQUIRE(metrics.getKerning('A', 'V') == font->getKerning('A', 'V', 18));
+            REQUIRE(metrics.getKerning(0, 'V') == 0);
+
+            const float lineHeight = 18 + font->getGlyph('g', 18, bold).bounds.height + font->getGlyph('g', 18, bold).bounds.top;
+            REQUIRE(metrics.getExtraVerticalSpace() == lineHeight - font->getLineSpacing(18));
+            REQUIRE(metrics.getExtraVerticalSpace() == tgui::Text::calculateExtraVerticalSpace(font, 18, bold ? sf::Text::Bold : sf::Text::Regular));
+        }
+    }
+
+    SECTION("Text size")
+    {
+        tgui::Text text;
+        text.setFont(font);
+        text.setCharacterSize(18);
+        text.setString("AVA\tg");
+
+        const float width = font->getGlyph('A', 18, false).advance * 2 + font->getGlyph('V', 18, false).advance
+                            + font->getGlyph(' ', 18, false).advance * 4 + font->getGlyph('g', 18, false).advance
+                            + font->getKerning('A', 'V', 18) + font->getKerning('V', 'A', 18)
+                            + font->getKerning('A', '\t', 18) + font->getKerning('\t', 'g', 18);
+        REQUIRE(text.getSize().x == Approx(width));
+        REQUIRE(text.getSize().y == Approx(font->getLineSpacing(18) + tgui::Text::calculateExtraVerticalSpace(font, 18)));
+    }
+
+    SECTION("Font destroyed")
+    {
+        auto tempFont = std::make_shared<sf::Font>(*font);
+        const float advance = tgui::FontMetrics::get(tempFont, 30, false).getAdvance('W');
+        tempFont = nullptr;
+
+        // A font that is created afterwards might get the same address, it should not reuse the old metrics
+        tempFont = std::make_shared<sf::Font>(*font);
+        REQUIRE(tgui::FontMetrics::get(tempFont, 30, false).getAdvance('W') == advance);
+        REQUIRE(tgui::FontMetrics::get(tempFont, 31, false).getAdvance('W') == font->getGlyph('W', 31, false).advance);
+    }
+}
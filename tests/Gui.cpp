@@ -0,0 +1,180 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "Tests.hpp"
+#include <TGUI/Gui.hpp>
+#include <TGUI/FontManager.hpp>
+#include <TGUI/Animation.hpp>
+#include <TGUI/Widgets/Button.hpp>
+#include <TGUI/Widgets/EditBox.hpp>
+
+TEST_CASE("[Gui]")
+{
+    sf::RenderTexture target;
+    target.create(100, 100);
+
+    tgui::Gui gui{target};
+
+    auto button = tgui::Button::create("Button");
+    button->setSize(50, 20);
+    gui.add(button);
+
+    SECTION("Default font")
+    {
+        REQUIRE(gui.getFont() != nullptr);
+
+        // All guis share the same default font
+        tgui::Gui gui2;
+        REQUIRE(gui2.getFont() == gui.getFont());
+        REQUIRE(tgui::FontManager::getDefaultFont() == gui.getFont());
+    }
+
+    SECTION("needsRedraw")
+    {
+        REQUIRE(gui.needsRedraw());
+        gui.draw();
+        REQUIRE(!gui.needsRedraw());
+
+        button->setText("Changed");
+        REQUIRE(gui.needsRedraw());
+        gui.draw();
+        REQUIRE(!gui.needsRedraw());
+
+        button->getRenderer()->setTextColor(sf::Color::Red);
+        REQUIRE(gui.needsRedraw());
+        gui.draw();
+
+        button->hide();
+        REQUIRE(gui.needsRedraw());
+        gui.draw();
+
+        // Hidden widgets don't make the gui change
+        button->setText("Hidden");
+        gui.draw();
+        REQUIRE(!gui.needsRedraw());
+
+        gui.setView(sf::View{{0, 0, 50, 50}});
+        REQUIRE(gui.needsRedraw());
+    }
+
+    SECTION("Events")
+    {
+        gui.draw();
+
+        sf::Event event;
+        event.type = sf::Event::MouseMoved;
+        event.mouseMove = {25, 10};
+        gui.handleEvent(event);
+        REQUIRE(gui.needsRedraw());
+    }
+
+    SECTION("Event queueing")
+    {
+        unsigned int mouseEnterCount = 0;
+        unsigned int mouseLeaveCount = 0;
+        unsigned int clickCount = 0;
+        button->onMouseEnter.connect([&]{ ++mouseEnterCount; });
+        button->onMouseLeave.connect([&]{ ++mouseLeaveCount; });
+        button->onClick.connect([&]{ ++clickCount; });
+
+        auto mouseMoved = [](int x, int y){
+                sf::Event event;
+                event.type = sf::Event::MouseMoved;
+                event.mouseMove = {x, y};
+                return event;
+            };
+
+        auto mouseButton = [](sf::Event::EventType type, int x, int y){
+                sf::Event event;
+                event.type = type;
+                event.mouseButton = {sf::Mouse::Left, x, y};
+                return event;
+            };
+
+        REQUIRE(!gui.isEventQueueingEnabled());
+        gui.setEventQueueing(true);
+        REQUIRE(gui.isEventQueueingEnabled());
+        gui.draw();
+
+        // Only the last of the consecutive move events reaches the widgets
+        REQUIRE(!gui.handleEvent(mouseMoved(75, 75)));
+        REQUIRE(!gui.handleEvent(mouseMoved(10, 10)));
+        REQUIRE(!gui.handleEvent(mouseMoved(80, 80)));
+        REQUIRE(gui.needsRedraw());
+        REQUIRE(gui.timeUntilNextUpdate() == sf::Time::Zero);
+        gui.draw();
+        REQUIRE(mouseEnterCount == 0);
+        REQUIRE(mouseLeaveCount == 0);
+
+        // Button events keep their order relative to the move events
+        gui.handleEvent(mouseMoved(20, 20));
+        gui.handleEvent(mouseMoved(10, 10));
+        gui.handleEvent(mouseButton(sf::Event::MouseButtonPressed, 10, 10));
+        gui.handleEvent(mouseButton(sf::Event::MouseButtonReleased, 10, 10));
+        gui.handleEvent(mouseMoved(85, 85));
+        gui.handleEvent(mouseMoved(90, 90));
+        REQUIRE(clickCount == 0);
+        gui.updateTime(sf::Time::Zero);
+        REQUIRE(mouseEnterCount == 1);
+        REQUIRE(mouseLeaveCount == 1);
+        REQUIRE(clickCount == 1);
+
+        // Disabling the queueing handles the remaining events
+        gui.handleEvent(mouseMoved(10, 10));
+        REQUIRE(mouseEnterCount == 1);
+        gui.setEventQueueing(false);
+        REQUIRE(mouseEnterCount == 2);
+
+        // Without queueing, every event is handled immediately
+        gui.handleEvent(mouseMoved(80, 80));
+        gui.handleEvent(mouseMoved(10, 10));
+        REQUIRE(mouseEnterCount == 3);
+        REQUIRE(mouseLeaveCount == 2);
+    }
+
+    SECTION("timeUntilNextUpdate")
+    {
+        gui.draw();
+        REQUIRE(gui.timeUntilNextUpdate() > sf::seconds(3600));
+
+        // A focused edit box has a blinking caret
+        auto editBox = tgui::EditBox::create();
+        gui.add(editBox);
+        editBox->focus();
+        gui.draw();
+        REQUIRE(gui.timeUntilNextUpdate() <= sf::milliseconds(500));
+        REQUIRE(!gui.needsRedraw());
+
+        editBox->unfocus();
+        gui.draw();
+        REQUIRE(gui.timeUntilNextUpdate() > sf::seconds(3600));
+
+        // Animations need to be drawn every frame
+        button->showWithEffect(tgui::ShowAnimationType::Fade, sf::seconds(1));
+        gui.draw();
+        REQUIRE(gui.timeUntilNextUpdate() == sf::Time::Zero);
+        REQUIRE(gui.needsRedraw());
+    }
+}
@@ -0,0 +1,119 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "Tests.hpp"
+#include <TGUI/InputValidator.hpp>
+#include <TGUI/Widgets/EditBox.hpp>
+
+TEST_CASE("[InputValidator]")
+{
+    SECTION("Default")
+    {
+        tgui::InputValidator validator;
+        REQUIRE(validator.getPattern() == ".*");
+        REQUIRE(validator.isIncremental());
+        REQUIRE(validator.match(""));
+        REQUIRE(validator.match("anything"));
+    }
+
+    SECTION("Predefined validators")
+    {
+        tgui::InputValidator intValidator{tgui::EditBox::Validator::Int};
+        REQUIRE(intValidator.isIncremental());
+        REQUIRE(intValidator.match(""));
+        REQUIRE(intValidator.match("-"));
+        REQUIRE(intValidator.match("+25"));
+        REQUIRE(!intValidator.match("2-5"));
+        REQUIRE(!intValidator.match("1.5"));
+
+        tgui::InputValidator uintValidator{tgui::EditBox::Validator::UInt};
+        REQUIRE(uintValidator.match("0123"));
+        REQUIRE(!uintValidator.match("-1"));
+
+        tgui::InputValidator floatValidator{tgui::EditBox::Validator::Float};
+        REQUIRE(floatValidator.match("-1.5"));
+        REQUIRE(floatValidator.match("."));
+        REQUIRE(floatValidator.match("+.5"));
+        REQUIRE(!floatValidator.match("1.5.2"));
+        REQUIRE(!floatValidator.match("1e5"));
+    }
+
+    SECTION("Automaton")
+    {
+        tgui::InputValidator validator{"[a-zA-Z_][a-zA-Z0-9_]*"};
+        REQUIRE(validator.isIncremental());
+        REQUIRE(!validator.match(""));
+        REQUIRE(validator.match("_name1"));
+        REQUIRE(!validator.match("1name"));
+
+        validator = tgui::InputValidator{"^(?:ab|c){2,3}\\d?$"};
+        REQUIRE(validator.isIncremental());
+        REQUIRE(validator.match("abc"));
+        REQUIRE(validator.match("ccab5"));
+        REQUIRE(!validator.match("c"));
+        REQUIRE(!validator.match("abababab"));
+
+        validator = tgui::InputValidator{"[^0-9]+|\\d{3}"};
+        REQUIRE(validator.match("abc"));
+        REQUIRE(validator.match("123"));
+        REQUIRE(!validator.match("12"));
+        REQUIRE(!validator.match("1a"));
+
+        // Characters outside the ascii range are matched as unicode code points
+        validator = tgui::InputValidator{".\\u00e9."};
+        REQUIRE(validator.match(sf::String(L"αé中")));
+        REQUIRE(!validator.match(sf::String(L"αe中")));
+    }
+
+    SECTION("Incremental matching")
+    {
+        tgui::InputValidator validator{"ab*c"};
+        tgui::InputValidator::State state = validator.getStartState();
+        REQUIRE(!validator.isAccepting(state));
+
+        state = validator.advance(state, 'a');
+        REQUIRE(!validator.isAccepting(state));
+        state = validator.advance(state, 'b');
+        state = validator.advance(state, 'b');
+        REQUIRE(!validator.isAccepting(state));
+        state = validator.advance(state, 'c');
+        REQUIRE(validator.isAccepting(state));
+
+        // Once the text can no longer match, adding characters won't help
+        state = validator.advance(state, 'c');
+        REQUIRE(!validator.isAccepting(state));
+        state = validator.advance(state, 'c');
+        REQUIRE(!validator.isAccepting(state));
+    }
+
+    SECTION("Fallback to std::regex")
+    {
+        tgui::InputValidator validator{"(a+)b\\1"};
+        REQUIRE(!validator.isIncremental());
+        REQUIRE(validator.match("aabaa"));
+        REQUIRE(!validator.match("aaba"));
+
+        REQUIRE_THROWS_AS(tgui::InputValidator{"[a-"}, std::regex_error);
+    }
+}
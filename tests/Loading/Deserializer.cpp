@@ -35,6 +35,10 @@ TEST_CASE("[Deserializer]")
         REQUIRE(tgui::Deserializer::deserialize(tgui::ObjectConverter::Type::Font, "\"resources/DejaVuSans.ttf\"").getFont() != nullptr);
         REQUIRE(tgui::Deserializer::deserialize(tgui::ObjectConverter::Type::Font, "nullptr").getFont() == nullptr);
         REQUIRE(tgui::Deserializer::deserialize(tgui::ObjectConverter::Type::Font, "null").getFont() == nullptr);
+
+        // The same file is only loaded once while the font is in use
+        const auto font = tgui::Deserializer::deserialize(tgui::ObjectConverter::Type::Font, "resources/DejaVuSans.ttf").getFont();
+        REQUIRE(tgui::Deserializer::deserialize(tgui::ObjectConverter::Type::Font, "\"resources/DejaVuSans.ttf\"").getFont() == font);
     }
 
     SECTION("deserialize color")
@@ -25,6 +25,9 @@
 #include "../Tests.hpp"
 #include <TGUI/Loading/Theme.hpp>
 #include <TGUI/Widgets/Label.hpp>
+#include <TGUI/Loading/WidgetLoader.hpp>
+#include <TGUI/FontMetrics.hpp>
+#include <TGUI/FontManager.hpp>
 
 // TODO: Reloading theme
 
@@ -124,6 +127,41 @@ TEST_CASE("[Theme]")
         }
     }
 
+    SECTION("preloadGlyphs")
+    {
+        std::stringstream stream{"Label { TextSize = 30; }\n"
+                                 "Panel { Button { TextSize = 14; } EditBox { TextSize = 0; } Label { TextSize = 30; } }"};
+        const std::vector<unsigned int> textSizes = tgui::WidgetLoader::findTextSizes(stream);
+        REQUIRE(textSizes.size() == 2);
+        REQUIRE(textSizes[0] == 14);
+        REQUIRE(textSizes[1] == 30);
+
+        // The font is loaded here so that no other test has used it yet
+        auto sfFont = std::make_shared<sf::Font>();
+        REQUIRE(sfFont->loadFromFile("resources/DejaVuSans.ttf"));
+
+        tgui::Theme theme{"resources/Black.txt"};
+        theme.addRenderer("CustomLabel", tgui::RendererData::create({{"font", tgui::Font{sfFont}}}));
+
+        const sf::Vector2u emptyPageSize = sfFont->getTexture(30).getSize();
+        theme.preloadGlyphs(textSizes);
+
+        // The glyphs were rendered to the texture of the font before any text used them
+        REQUIRE(sfFont->getTexture(30).getSize() != emptyPageSize);
+        REQUIRE(sfFont->getTexture(14).getSize() != emptyPageSize);
+        REQUIRE(sfFont->getTexture(20).getSize() == emptyPageSize);
+
+        // The default font is used by widgets that don't have a font in their renderer
+        REQUIRE(tgui::FontManager::getDefaultFont()->getTexture(30).getSize() != emptyPageSize);
+
+        tgui::Font font{"resources/DejaVuSans.ttf"};
+        font.preloadGlyphs("abc", 20, true);
+        REQUIRE(tgui::FontMetrics::get(font, 20, true).getAdvance('a') == font.getGlyph('a', 20, true).advance);
+
+        // Nothing happens without a font
+        tgui::Font{}.preloadGlyphs("abc", 20);
+    }
+
     SECTION("setThemeLoader")
     {
         struct CustomThemeLoader : public tgui::BaseThemeLoader
@@ -24,6 +24,9 @@
 
 #include "../Tests.hpp"
 #include <TGUI/Loading/ThemeLoader.hpp>
+#include <TGUI/TextureManager.hpp>
+#include <TGUI/Texture.hpp>
+#include <algorithm>
 
 // Ignore warning "C4503: decorated name length exceeded, name was truncated" in Visual Studio
 #if defined _MSC_VER
@@ -74,6 +77,14 @@ TEST_CASE("[ThemeLoader]")
         REQUIRE(properties["textcolor"] == "#ABCDEF");
     }
 
+    SECTION("section names")
+    {
+        const std::vector<std::string> sections = loader->getSecondaryParameters("resources/ThemeComments.txt");
+        REQUIRE(sections.size() == 3);
+        REQUIRE(std::find(sections.begin(), sections.end(), "button1") != sections.end());
+        REQUIRE(std::find(sections.begin(), sections.end(), "correctname") != sections.end());
+    }
+
     SECTION("load theme with nested sections")
     {
         std::map<sf::String, sf::String> properties = loader->load("resources/ThemeNested.txt", "ListBox1");
@@ -189,4 +200,22 @@ TEST_CASE("[ThemeLoader]")
             REQUIRE(tgui::DefaultThemeLoaderTest::getPropertiesCache(loader).size() == 0);
         }
     }
+
+    SECTION("texture atlas")
+    {
+        REQUIRE(!tgui::DefaultThemeLoader::isTextureAtlasEnabled());
+        tgui::DefaultThemeLoader::setTextureAtlasEnabled(true);
+        REQUIRE(tgui::DefaultThemeLoader::isTextureAtlasEnabled());
+
+        loader->preload("resources/Black.txt");
+
+        // The atlas contains a transparent border around the image
+        tgui::Texture texture{"resources/Black.png", {0, 0, 10, 10}};
+        REQUIRE(texture.getData()->texture->getSize() != texture.getData()->image->getSize());
+        REQUIRE(texture.getData()->textureRect == sf::IntRect(0, 0, 10, 10));
+
+        tgui::DefaultThemeLoader::setTextureAtlasEnabled(false);
+        tgui::TextureManager::removeAtlases();
+        tgui::DefaultThemeLoader::flushCache();
+    }
 }
@@ -0,0 +1,80 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "Tests.hpp"
+#include <TGUI/MappedFile.hpp>
+#include <fstream>
+
+TEST_CASE("[MappedFile]")
+{
+    tgui::MappedFile file;
+
+    {
+        std::ofstream out{"MappedFile.txt", std::ios::binary};
+        out << "First line\nSecond line";
+    }
+
+    SECTION("Non-existent file")
+    {
+        REQUIRE(!file.open("resources/NonExistentFile.txt"));
+        REQUIRE(!file.open("resources/NonExistentFile.txt", false));
+        REQUIRE(file.getData() == nullptr);
+        REQUIRE(file.getSize() == 0);
+    }
+
+    SECTION("Empty file")
+    {
+        std::ofstream{"MappedFileEmpty.txt"};
+        REQUIRE(file.open("MappedFileEmpty.txt"));
+        REQUIRE(file.getData() == nullptr);
+        REQUIRE(file.getSize() == 0);
+
+        REQUIRE(file.open("MappedFileEmpty.txt", false));
+        REQUIRE(file.getData() == nullptr);
+        REQUIRE(file.getSize() == 0);
+    }
+
+    SECTION("Read without mapping")
+    {
+        REQUIRE(file.open("MappedFile.txt", false));
+        REQUIRE(!file.isMapped());
+        REQUIRE(std::string(file.getData(), file.getSize()) == "First line\nSecond line");
+
+        file.close();
+        REQUIRE(file.getData() == nullptr);
+        REQUIRE(file.getSize() == 0);
+    }
+
+    SECTION("Mapped or read")
+    {
+        // The file is read instead when mapping is not supported
+        REQUIRE(file.open("MappedFile.txt"));
+        REQUIRE(std::string(file.getData(), file.getSize()) == "First line\nSecond line");
+
+        // Opening another file releases the previous one
+        REQUIRE(file.open("MappedFile.txt", false));
+        REQUIRE(!file.isMapped());
+        REQUIRE(std::string(file.getData(), file.getSize()) == "First line\nSecond line");
+    }
+}
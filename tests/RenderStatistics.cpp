@@ -0,0 +1,110 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "Tests.hpp"
+#include <TGUI/RenderStatistics.hpp>
+#include <TGUI/Gui.hpp>
+#include <TGUI/Widgets/Button.hpp>
+#include <TGUI/Widgets/Panel.hpp>
+
+TEST_CASE("[RenderStatistics]")
+{
+    sf::RenderTexture target;
+    target.create(100, 100);
+
+    tgui::Gui gui{target};
+
+    auto panel = tgui::Panel::create({80, 60});
+    panel->setPosition(10, 10);
+    gui.add(panel, "Panel1");
+
+    auto button1 = tgui::Button::create("1");
+    button1->setSize(30, 20);
+    panel->add(button1);
+
+    auto button2 = tgui::Button::create("2");
+    button2->setSize(30, 20);
+    button2->setPosition(100, 0);
+    panel->add(button2);
+
+    auto button3 = tgui::Button::create("3");
+    button3->setPosition(-50, -50);
+    button3->setSize(30, 20);
+    gui.add(button3);
+
+    SECTION("Disabled by default")
+    {
+        REQUIRE(!gui.isRenderStatisticsEnabled());
+        gui.draw();
+        REQUIRE(gui.getRenderStatistics().drawCalls == 0);
+        REQUIRE(gui.getRenderStatistics().widgetsVisited == 0);
+        REQUIRE(gui.getRenderStatistics().widgetTimes.empty());
+        REQUIRE(tgui::RenderStatistics::getActive() == nullptr);
+    }
+
+    SECTION("Collecting")
+    {
+        gui.setRenderStatisticsEnabled(true);
+        REQUIRE(gui.isRenderStatisticsEnabled());
+
+        gui.draw();
+        REQUIRE(tgui::RenderStatistics::getActive() == nullptr);
+
+        const tgui::RenderStatistics& statistics = gui.getRenderStatistics();
+        REQUIRE(statistics.widgetsVisited == 2);
+        REQUIRE(statistics.widgetsCulled == 2);
+        REQUIRE(statistics.drawCalls > 0);
+        REQUIRE(statistics.vertices > 0);
+        REQUIRE(statistics.textureSwitches > 0);
+        REQUIRE(statistics.scissorChanges > 0);
+        REQUIRE(statistics.widgetTimes.size() == 1);
+        REQUIRE(statistics.widgetTimes[0].widget.lock() == panel);
+        REQUIRE(statistics.widgetTimes[0].widgetName == "Panel1");
+        REQUIRE(statistics.widgetTimes[0].widgetType == "Panel");
+
+        // The statistics only contain the last frame
+        const std::size_t drawCalls = statistics.drawCalls;
+        gui.draw();
+        REQUIRE(statistics.drawCalls == drawCalls);
+
+        // Batching reduces the amount of draw calls
+        gui.setDrawBatching(true);
+        gui.draw();
+        REQUIRE(statistics.drawCalls < drawCalls);
+
+        // The statistics don't keep removed widgets alive
+        std::weak_ptr<tgui::Widget> removedPanel = panel;
+        gui.remove(panel);
+        panel = nullptr;
+        REQUIRE(removedPanel.expired());
+        REQUIRE(statistics.widgetTimes.size() == 1);
+        REQUIRE(statistics.widgetTimes[0].widget.expired());
+        REQUIRE(statistics.widgetTimes[0].widgetName == "Panel1");
+
+        gui.setRenderStatisticsEnabled(false);
+        REQUIRE(!gui.isRenderStatisticsEnabled());
+        REQUIRE(statistics.drawCalls == 0);
+    }
+}
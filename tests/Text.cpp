@@ -24,6 +24,9 @@
 
 #include "Tests.hpp"
 #include <TGUI/Text.hpp>
+#include <TGUI/DrawBatch.hpp>
+#include <TGUI/RenderStatistics.hpp>
+#include <cstring>
 
 TEST_CASE("[Text]")
 {
@@ -135,4 +138,114 @@ TEST_CASE("[Text]")
             REQUIRE(text.getSize().y == text3.getSize().y);
         }
     }
+
+    SECTION("Line breaks")
+    {
+        const tgui::Font font{"resources/DejaVuSans.ttf"};
+        text.setFont(font);
+        text.setCharacterSize(20);
+        text.setString("Hello world");
+        const float width = text.getSize().x;
+
+        REQUIRE(tgui::Text::findLineBreaks(width, "", font, 20, false).empty());
+        REQUIRE(tgui::Text::findLineBreaks(width, "Hello", font, 20, false).empty());
+        REQUIRE((tgui::Text::findLineBreaks(width, "Hello world again", font, 20, false) == std::vector<std::size_t>{12}));
+        REQUIRE((tgui::Text::findLineBreaks(width, "Hello world again", font, 20, false, false) == std::vector<std::size_t>{11}));
+        REQUIRE((tgui::Text::findLineBreaks(width, "Hello\nworld\n", font, 20, false) == std::vector<std::size_t>{6, 12}));
+
+        // Without a width or without a font, the text is only split on newlines
+        REQUIRE((tgui::Text::findLineBreaks(0, "Hello world again\n\nx", font, 20, false) == std::vector<std::size_t>{18, 19}));
+        REQUIRE((tgui::Text::findLineBreaks(width, "Hello world again\n\nx", nullptr, 20, false) == std::vector<std::size_t>{18, 19}));
+
+        REQUIRE(tgui::Text::wordWrap(width, "Hello world again", font, 20, false) == "Hello world \nagain");
+        REQUIRE(tgui::Text::wordWrap(width, "Hello world again", font, 20, false, false) == "Hello world\n again");
+        REQUIRE(tgui::Text::wordWrap(width, "Hello\nworld\n", font, 20, false) == "Hello\nworld\n");
+        REQUIRE(tgui::Text::wordWrap(width / 4, "Hello", font, 20, false).find('\n') != sf::String::InvalidPos);
+        REQUIRE(tgui::Text::wordWrap(width, "Hello", nullptr, 20, false) == "");
+    }
+
+    SECTION("Draw")
+    {
+        sf::RenderTexture target;
+        target.create(200, 100);
+
+        text.setFont("resources/DejaVuSans.ttf");
+        text.setCharacterSize(20);
+        text.setColor(sf::Color::Red);
+        text.setString("TGUI\ntext");
+        text.setPosition(10, 10);
+
+        sf::Text sfmlText{"TGUI\ntext", *text.getFont().getFont(), 20};
+        sfmlText.setFillColor(sf::Color::Red);
+        sfmlText.setPosition(10, 10);
+
+        // The text should look exactly the same as when sfml would have drawn it
+        const auto compareWithSfmlText = [&](bool batching)
+            {
+                target.clear();
+                if (batching)
+                {
+                    tgui::DrawBatch batch{target};
+                    text.draw(target, sf::RenderStates::Default);
+                }
+                else
+                    text.draw(target, sf::RenderStates::Default);
+                target.display();
+                const sf::Image image = target.getTexture().copyToImage();
+
+                target.clear();
+                target.draw(sfmlText);
+                target.display();
+                const sf::Image expectedImage = target.getTexture().copyToImage();
+
+                REQUIRE(std::memcmp(image.getPixelsPtr(), expectedImage.getPixelsPtr(), 4 * 200 * 100) == 0);
+            };
+
+        SECTION("Regular")
+        {
+            compareWithSfmlText(false);
+            compareWithSfmlText(true);
+        }
+
+        SECTION("Styled")
+        {
+            text.setStyle(sf::Text::Bold | sf::Text::Italic | sf::Text::Underlined);
+            sfmlText.setStyle(sf::Text::Bold | sf::Text::Italic | sf::Text::Underlined);
+            compareWithSfmlText(false);
+            compareWithSfmlText(true);
+        }
+
+        SECTION("Changes after the first draw")
+        {
+            compareWithSfmlText(false);
+
+            text.setPosition(30, 20);
+            text.setOpacity(0.5f);
+            sfmlText.setPosition(30, 20);
+            sfmlText.setFillColor(tgui::Color::calcColorOpacity(sf::Color::Red, 0.5f));
+            compareWithSfmlText(false);
+            compareWithSfmlText(true);
+
+            text.setString("Other\ntext");
+            sfmlText.setString("Other\ntext");
+            compareWithSfmlText(false);
+            compareWithSfmlText(true);
+        }
+
+        SECTION("Glyphs are drawn in one call")
+        {
+            tgui::RenderStatistics statistics;
+            tgui::RenderStatistics::setActive(&statistics);
+
+            text.draw(target, sf::RenderStates::Default);
+            REQUIRE(statistics.drawCalls == 1);
+            REQUIRE(statistics.vertices == 6 * 8);
+
+            text.setString("");
+            text.draw(target, sf::RenderStates::Default);
+            REQUIRE(statistics.drawCalls == 1);
+
+            tgui::RenderStatistics::setActive(nullptr);
+        }
+    }
 }
@@ -0,0 +1,86 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2017 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "Tests.hpp"
+#include <TGUI/TextDocument.hpp>
+#include <fstream>
+
+TEST_CASE("[TextDocument]")
+{
+    tgui::TextDocument document;
+
+    SECTION("Non-existent file")
+    {
+        REQUIRE(!document.open("resources/NonExistentFile.txt"));
+        sf::String line;
+        REQUIRE(!document.readLine(0, line));
+    }
+
+    SECTION("Empty file")
+    {
+        std::ofstream{"TextDocumentEmpty.txt"};
+        REQUIRE(document.open("TextDocumentEmpty.txt"));
+        REQUIRE(document.isIndexComplete());
+        REQUIRE(document.getLineCount() == 1);
+
+        sf::String line = "x";
+        REQUIRE(document.readLine(0, line));
+        REQUIRE(line == "");
+        REQUIRE(!document.readLine(1, line));
+    }
+
+    SECTION("Lines")
+    {
+        {
+            std::ofstream file{"TextDocumentLines.txt", std::ios::binary};
+            file << "\xEF\xBB\xBF" << "First\r\n" << "\xC3\xA9t\xC3\xA9\n";
+            for (unsigned int i = 2; i < 1000; ++i)
+                file << "Line " << i << "\n";
+            file << "Last";
+        }
+
+        REQUIRE(document.open("TextDocumentLines.txt"));
+        REQUIRE(!document.isIndexComplete());
+
+        sf::String line;
+        REQUIRE(document.readLine(0, line));
+        REQUIRE(line == "First");
+        REQUIRE(document.readLine(1, line));
+        REQUIRE(line == L"\u00E9t\u00E9");
+
+        // Lines are found in the middle of the file before the whole file has been scanned
+        REQUIRE(document.readLine(130, line));
+        REQUIRE(line == "Line 130");
+
+        while (!document.buildIndex(100))
+            ;
+
+        REQUIRE(document.getLineCount() == 1001);
+        REQUIRE(document.readLine(999, line));
+        REQUIRE(line == "Line 999");
+        REQUIRE(document.readLine(1000, line));
+        REQUIRE(line == "Last");
+        REQUIRE(!document.readLine(1001, line));
+    }
+}
@@ -64,7 +64,7 @@ TEST_CASE("[Texture]")
                 REQUIRE(texture.getId() == "resources/image.png");
                 REQUIRE(texture.getData() != nullptr);
                 REQUIRE(texture.getData()->image != nullptr);
-                REQUIRE(texture.getData()->texture.getSize() == sf::Vector2u(50, 50));
+                REQUIRE(texture.getData()->texture->getSize() == sf::Vector2u(50, 50));
                 REQUIRE(texture.getData()->rect == sf::IntRect());
                 REQUIRE(texture.getImageSize() == sf::Vector2f(50, 50));
                 REQUIRE(texture.getMiddleRect() == sf::IntRect(0, 0, 50, 50));
@@ -78,7 +78,8 @@ TEST_CASE("[Texture]")
                 REQUIRE(texture.getId() == "resources/image.png");
                 REQUIRE(texture.getData() != nullptr);
                 REQUIRE(texture.getData()->image != nullptr);
-                REQUIRE(texture.getData()->texture.getSize() == sf::Vector2u(40, 30));
+                REQUIRE(texture.getData()->texture->getSize() == sf::Vector2u(50, 50));
+                REQUIRE(texture.getData()->textureRect == sf::IntRect(10, 5, 40, 30));
                 REQUIRE(texture.getData()->rect == sf::IntRect(10, 5, 40, 30));
                 REQUIRE(texture.getImageSize() == sf::Vector2f(40, 30));
                 REQUIRE(texture.getMiddleRect() == sf::IntRect(6, 5, 28, 20));
@@ -110,7 +111,7 @@ TEST_CASE("[Texture]")
             REQUIRE(texture.getId() == "resources/image.png");
             REQUIRE(texture.getData() != nullptr);
             REQUIRE(texture.getData()->image != nullptr);
-            REQUIRE(texture.getData()->texture.getSize() == sf::Vector2u(50, 50));
+            REQUIRE(texture.getData()->texture->getSize() == sf::Vector2u(50, 50));
             REQUIRE(texture.getData()->rect == sf::IntRect());
             REQUIRE(texture.getImageSize() == sf::Vector2f(50, 50));
             REQUIRE(texture.getMiddleRect() == sf::IntRect(10, 0, 30, 50));
@@ -123,7 +124,7 @@ TEST_CASE("[Texture]")
                 REQUIRE(textureCopy.getId() == "resources/image.png");
                 REQUIRE(textureCopy.getData() != nullptr);
                 REQUIRE(textureCopy.getData()->image != nullptr);
-                REQUIRE(textureCopy.getData()->texture.getSize() == sf::Vector2u(50, 50));
+                REQUIRE(textureCopy.getData()->texture->getSize() == sf::Vector2u(50, 50));
                 REQUIRE(textureCopy.getData()->rect == sf::IntRect());
                 REQUIRE(textureCopy.getImageSize() == sf::Vector2f(50, 50));
                 REQUIRE(textureCopy.getMiddleRect() == sf::IntRect(10, 0, 30, 50));
@@ -142,7 +143,7 @@ TEST_CASE("[Texture]")
                 REQUIRE(textureCopy.getId() == "resources/image.png");
                 REQUIRE(textureCopy.getData() != nullptr);
                 REQUIRE(textureCopy.getData()->image != nullptr);
-                REQUIRE(textureCopy.getData()->texture.getSize() == sf::Vector2u(50, 50));
+                REQUIRE(textureCopy.getData()->texture->getSize() == sf::Vector2u(50, 50));
                 REQUIRE(textureCopy.getData()->rect == sf::IntRect());
                 REQUIRE(textureCopy.getImageSize() == sf::Vector2f(50, 50));
                 REQUIRE(textureCopy.getMiddleRect() == sf::IntRect(10, 0, 30, 50));
@@ -52,4 +52,58 @@ TEST_CASE("[TextureManager]")
     REQUIRE_NOTHROW(tgui::TextureManager::removeTexture(textureData1));
     REQUIRE_NOTHROW(tgui::TextureManager::removeTexture(textureData1));
     REQUIRE_THROWS_AS(tgui::TextureManager::removeTexture(textureData1), tgui::Exception);
+
+    SECTION("Parts of same image")
+    {
+        tgui::Texture texture3{"resources/image.png", {0, 0, 20, 30}};
+        tgui::Texture texture4{"resources/image.png", {20, 10, 30, 40}};
+        REQUIRE(texture3.getData() != texture4.getData());
+        REQUIRE(texture3.getData()->texture == texture4.getData()->texture);
+        REQUIRE(texture3.getData()->image == texture4.getData()->image);
+        REQUIRE(texture3.getData()->textureRect == sf::IntRect(0, 0, 20, 30));
+        REQUIRE(texture4.getData()->textureRect == sf::IntRect(20, 10, 30, 40));
+        REQUIRE(texture4.getImageSize() == sf::Vector2f(30, 40));
+
+        // A smoothed part gets a texture of its own, the other parts aren't affected
+        texture4.setSmooth(true);
+        REQUIRE(texture4.getData()->texture != texture3.getData()->texture);
+        REQUIRE(texture4.getData()->textureRect == sf::IntRect(0, 0, 30, 40));
+        REQUIRE(texture4.getImageSize() == sf::Vector2f(30, 40));
+        REQUIRE(texture4.isSmooth());
+        REQUIRE(!texture3.isSmooth());
+
+        // New parts don't share the texture of the smoothed part
+        tgui::Texture texture5{"resources/image.png", {5, 5, 10, 10}};
+        REQUIRE(texture5.getData()->texture == texture3.getData()->texture);
+        REQUIRE(!texture5.isSmooth());
+    }
+
+    SECTION("Atlas")
+    {
+        REQUIRE(!tgui::TextureManager::createAtlas({}));
+        REQUIRE(tgui::TextureManager::createAtlas({"resources/Texture1.png", "resources/Texture2.png", "resources/image.png"}));
+
+        tgui::Texture texture3{"resources/Texture1.png"};
+        tgui::Texture texture4{"resources/Texture2.png"};
+        tgui::Texture texture5{"resources/image.png", {10, 5, 40, 30}};
+        REQUIRE(texture3.getData()->texture == texture4.getData()->texture);
+        REQUIRE(texture3.getData()->texture == texture5.getData()->texture);
+        REQUIRE(texture3.getData()->textureRect != texture4.getData()->textureRect);
+        REQUIRE(texture5.getImageSize() == sf::Vector2f(40, 30));
+
+        texture5.setSmooth(true);
+        REQUIRE(texture5.getData()->texture != texture3.getData()->texture);
+        REQUIRE(!texture3.isSmooth());
+
+        tgui::TextureManager::removeAtlases();
+
+        tgui::Texture texture6{"resources/Texture1.png", {0, 0, 5, 5}};
+        REQUIRE(texture6.getData()->texture != texture3.getData()->texture);
+        REQUIRE(texture6.getData()->textureRect == sf::IntRect(0, 0, 5, 5));
+
+        // Parts loaded after the atlas was removed share their own texture
+        tgui::Texture texture7{"resources/Texture1.png", {5, 5, 5, 5}};
+        REQUIRE(texture7.getData()->texture == texture6.getData()->texture);
+        REQUIRE(texture7.getData()->textureRect == sf::IntRect(5, 5, 5, 5));
+    }
 }
@@ -24,6 +24,7 @@
 
 #include "../Tests.hpp"
 #include <TGUI/Widgets/ChatBox.hpp>
+#include <SFML/System/Thread.hpp>
 
 TEST_CASE("[ChatBox]")
 {
@@ -50,7 +51,7 @@ TEST_CASE("[ChatBox]")
     SECTION("Adding lines")
     {
         std::shared_ptr<sf::Font> font1 = tgui::Font{"resources/DejaVuSans.ttf"}.getFont();
-        std::shared_ptr<sf::Font> font2 = tgui::Font{"resources/DejaVuSans.ttf"}.getFont();
+        std::shared_ptr<sf::Font> font2 = std::make_shared<sf::Font>(*font1);
 
         chatBox->setTextColor(sf::Color::Black);
         chatBox->setTextSize(24);
@@ -152,6 +153,104 @@ TEST_CASE("[ChatBox]")
         }
     }
 
+    SECTION("Many lines")
+    {
+        chatBox->getRenderer()->setFont("resources/DejaVuSans.ttf");
+        chatBox->setLineLimit(1000);
+
+        for (unsigned int i = 0; i < 2500; ++i)
+            chatBox->addLine("Line " + tgui::to_string(i) + ", which is long enough to be split over multiple lines");
+
+        REQUIRE(chatBox->getLineAmount() == 1000);
+        REQUIRE(chatBox->getLine(0).substring(0, 9) == "Line 1500");
+        REQUIRE(chatBox->getLine(999).substring(0, 9) == "Line 2499");
+
+        REQUIRE(chatBox->removeLine(500));
+        REQUIRE(chatBox->getLine(499).substring(0, 9) == "Line 1999");
+        REQUIRE(chatBox->getLine(500).substring(0, 9) == "Line 2001");
+
+        chatBox->setSize(400, 300);
+        chatBox->setLineLimit(10);
+        REQUIRE(chatBox->getLineAmount() == 10);
+        REQUIRE(chatBox->getLine(0).substring(0, 9) == "Line 2490");
+
+        chatBox->setNewLinesBelowOthers(false);
+        chatBox->addLine("First");
+        REQUIRE(chatBox->getLineAmount() == 10);
+        REQUIRE(chatBox->getLine(0) == "First");
+        REQUIRE(chatBox->getLine(9).substring(0, 9) == "Line 2498");
+    }
+
+    SECTION("Queued lines")
+    {
+        chatBox->setTextColor(sf::Color::Green);
+        chatBox->queueLine("Line 1");
+        chatBox->queueLine("Line 2", sf::Color::Red);
+        chatBox->queueLine("Line 3", 24);
+        REQUIRE(chatBox->getLineAmount() == 0);
+
+        chatBox->update({});
+        REQUIRE(chatBox->getLineAmount() == 3);
+        REQUIRE(chatBox->getLine(0) == "Line 1");
+        REQUIRE(chatBox->getLineColor(0) == sf::Color::Green);
+        REQUIRE(chatBox->getLine(1) == "Line 2");
+        REQUIRE(chatBox->getLineColor(1) == sf::Color::Red);
+        REQUIRE(chatBox->getLine(2) == "Line 3");
+        REQUIRE(chatBox->getLineTextSize(2) == 24);
+
+        chatBox->update({});
+        REQUIRE(chatBox->getLineAmount() == 3);
+
+        SECTION("Line limit")
+        {
+            chatBox->setLineLimit(5);
+            for (unsigned int i = 4; i <= 20; ++i)
+                chatBox->queueLine("Line " + tgui::to_string(i));
+
+            chatBox->update({});
+            REQUIRE(chatBox->getLineAmount() == 5);
+            REQUIRE(chatBox->getLine(0) == "Line 16");
+            REQUIRE(chatBox->getLine(4) == "Line 20");
+        }
+
+        SECTION("Hidden")
+        {
+            chatBox->setLineLimit(5);
+            chatBox->hide();
+            REQUIRE(chatBox->timeUntilNextUpdate() > sf::seconds(3600));
+
+            for (unsigned int i = 4; i <= 20; ++i)
+                chatBox->queueLine("Line " + tgui::to_string(i));
+            REQUIRE(chatBox->timeUntilNextUpdate() == sf::Time::Zero);
+
+            chatBox->show();
+            REQUIRE(chatBox->timeUntilNextUpdate() > sf::seconds(3600));
+            REQUIRE(chatBox->getLineAmount() == 5);
+            REQUIRE(chatBox->getLine(0) == "Line 16");
+            REQUIRE(chatBox->getLine(4) == "Line 20");
+        }
+
+        SECTION("Multiple threads")
+        {
+            chatBox->removeAllLines();
+
+            auto producer = [=]{
+                for (unsigned int i = 0; i < 1000; ++i)
+                    chatBox->queueLine("Line " + tgui::to_string(i));
+            };
+
+            sf::Thread thread1{producer};
+            sf::Thread thread2{producer};
+            thread1.launch();
+            thread2.launch();
+            thread1.wait();
+            thread2.wait();
+
+            chatBox->update({});
+            REQUIRE(chatBox->getLineAmount() == 2000);
+        }
+    }
+
     SECTION("Default text size")
     {
         chatBox->setTextSize(30);
@@ -173,7 +272,7 @@ TEST_CASE("[ChatBox]")
     SECTION("Get unexisting line")
     {
         std::shared_ptr<sf::Font> font1 = tgui::Font{"resources/DejaVuSans.ttf"}.getFont();
-        std::shared_ptr<sf::Font> font2 = tgui::Font{"resources/DejaVuSans.ttf"}.getFont();
+        std::shared_ptr<sf::Font> font2 = std::make_shared<sf::Font>(*font1);
 
         chatBox->setTextColor(sf::Color::Yellow);
         chatBox->setTextSize(26);
@@ -24,6 +24,7 @@
 
 #include "../Tests.hpp"
 #include <TGUI/Widgets/EditBox.hpp>
+#include <TGUI/Clipboard.hpp>
 
 TEST_CASE("[EditBox]")
 {
@@ -145,6 +146,65 @@ TEST_CASE("[EditBox]")
         REQUIRE(editBox->getText() == "yet another text");
     }
 
+    SECTION("Long text")
+    {
+        editBox->setTextSize(16);
+        editBox->setSize(100, 25);
+        editBox->setText(sf::String(std::string(5000, 'x')));
+        REQUIRE(editBox->getCaretPosition() == 5000);
+
+        editBox->setCaretPosition(2500);
+        editBox->textEntered('a');
+        editBox->textEntered('b');
+        REQUIRE(editBox->getText().getSize() == 5002);
+        REQUIRE(editBox->getText().substring(2499, 4) == "xabx");
+        REQUIRE(editBox->getCaretPosition() == 2502);
+
+        sf::Event::KeyEvent event;
+        event.control = false;
+        event.alt     = false;
+        event.shift   = false;
+        event.system  = false;
+        event.code    = sf::Keyboard::BackSpace;
+        editBox->keyPressed(event);
+        REQUIRE(editBox->getText().substring(2499, 3) == "xax");
+        REQUIRE(editBox->getCaretPosition() == 2501);
+
+        editBox->selectText(100, 50);
+        event.control = true;
+        event.code = sf::Keyboard::X;
+        editBox->keyPressed(event);
+        REQUIRE(editBox->getText().getSize() == 4951);
+        REQUIRE(tgui::Clipboard::get() == std::string(50, 'x'));
+        REQUIRE(editBox->getCaretPosition() == 100);
+
+        event.code = sf::Keyboard::V;
+        editBox->keyPressed(event);
+        REQUIRE(editBox->getText().getSize() == 5001);
+        REQUIRE(editBox->getText().substring(2499, 3) == "xax");
+        REQUIRE(editBox->getCaretPosition() == 150);
+
+        // Clicking on the left side of the edit box places the caret in front of the first visible character
+        editBox->setPosition(0, 0);
+        editBox->setCaretPosition(0);
+        editBox->leftMousePressed({1, 10});
+        editBox->leftMouseReleased({1, 10});
+        REQUIRE(editBox->getCaretPosition() == 0);
+
+        // Clicking on the right side places it behind the last visible character
+        editBox->leftMousePressed({99, 10});
+        editBox->leftMouseReleased({99, 10});
+        REQUIRE(editBox->getCaretPosition() > 0);
+        REQUIRE(editBox->getCaretPosition() < 100);
+
+        // The password character is copied instead of the real text
+        editBox->setPasswordCharacter('*');
+        editBox->selectText(10, 3);
+        event.code = sf::Keyboard::C;
+        editBox->keyPressed(event);
+        REQUIRE(tgui::Clipboard::get() == "***");
+    }
+
     SECTION("ReadOnly")
     {
         REQUIRE(!editBox->isReadOnly());
@@ -229,6 +289,37 @@ TEST_CASE("[EditBox]")
                 editBox->textEntered('-');
                 REQUIRE(editBox->getText() == "-");
             }
+
+            SECTION("Pasting characters")
+            {
+                sf::Event::KeyEvent event;
+                event.control = true;
+                event.alt     = false;
+                event.shift   = false;
+                event.system  = false;
+                event.code    = sf::Keyboard::V;
+
+                tgui::Clipboard::set("1x");
+                editBox->keyPressed(event);
+                REQUIRE(editBox->getText() == "+25");
+
+                tgui::Clipboard::set("00");
+                editBox->keyPressed(event);
+                REQUIRE(editBox->getText() == "+2500");
+                REQUIRE(editBox->getCaretPosition() == 5);
+
+                editBox->setCaretPosition(0);
+                tgui::Clipboard::set("-");
+                editBox->keyPressed(event);
+                REQUIRE(editBox->getText() == "+2500");
+
+                editBox->setMaximumCharacters(7);
+                editBox->setCaretPosition(1);
+                tgui::Clipboard::set("123");
+                editBox->keyPressed(event);
+                REQUIRE(editBox->getText() == "+122500");
+                REQUIRE(editBox->getCaretPosition() == 3);
+            }
         }
 
         SECTION("UInt")
@@ -24,6 +24,8 @@
 
 #include "../Tests.hpp"
 #include <TGUI/Widgets/TextBox.hpp>
+#include <TGUI/RenderStatistics.hpp>
+#include <fstream>
 
 TEST_CASE("[TextBox]")
 {
@@ -106,6 +108,225 @@ TEST_CASE("[TextBox]")
         }
     }
 
+    SECTION("Editing")
+    {
+        const sf::String text = "First paragraph containing enough words to be word-wrapped\nSecond\nThird";
+        textBox->setSize(120, 200);
+        textBox->setText(text);
+
+        const std::size_t linesCount = textBox->getLinesCount();
+        REQUIRE(linesCount > 3);
+
+        sf::Event::KeyEvent event;
+        event.control = false;
+        event.alt     = false;
+        event.shift   = false;
+        event.system  = false;
+
+        SECTION("Typing and removing characters")
+        {
+            textBox->setCaretPosition(0);
+            textBox->textEntered('X');
+            REQUIRE(textBox->getText() == "X" + text);
+            REQUIRE(textBox->getCaretPosition() == 1);
+
+            event.code = sf::Keyboard::BackSpace;
+            textBox->keyPressed(event);
+            REQUIRE(textBox->getText() == text);
+            REQUIRE(textBox->getCaretPosition() == 0);
+
+            event.code = sf::Keyboard::Delete;
+            textBox->keyPressed(event);
+            REQUIRE(textBox->getText() == text.substring(1));
+            REQUIRE(textBox->getLinesCount() <= linesCount);
+        }
+
+        SECTION("Removing and inserting newlines")
+        {
+            const std::size_t secondParagraphStart = text.find("Second");
+            textBox->setCaretPosition(secondParagraphStart);
+
+            event.code = sf::Keyboard::BackSpace;
+            textBox->keyPressed(event);
+            REQUIRE(textBox->getText() == text.substring(0, secondParagraphStart - 1) + text.substring(secondParagraphStart));
+            REQUIRE(textBox->getCaretPosition() == secondParagraphStart - 1);
+
+            event.code = sf::Keyboard::Return;
+            textBox->keyPressed(event);
+            REQUIRE(textBox->getText() == text);
+            REQUIRE(textBox->getLinesCount() == linesCount);
+            REQUIRE(textBox->getCaretPosition() == secondParagraphStart);
+        }
+
+        SECTION("Removing characters at the end of a word-wrapped line")
+        {
+            textBox->setCaretPosition(0);
+            event.code = sf::Keyboard::End;
+            textBox->keyPressed(event);
+
+            const std::size_t lineEnd = textBox->getCaretPosition();
+            REQUIRE(lineEnd > 0);
+            REQUIRE(lineEnd < text.find("\n"));
+
+            event.code = sf::Keyboard::BackSpace;
+            textBox->keyPressed(event);
+            REQUIRE(textBox->getText() == text.substring(0, lineEnd - 1) + text.substring(lineEnd));
+            REQUIRE(textBox->getCaretPosition() == lineEnd - 1);
+        }
+
+        SECTION("Replacing the selection")
+        {
+            event.control = true;
+            event.code = sf::Keyboard::A;
+            textBox->keyPressed(event);
+            REQUIRE(textBox->getSelectedText() == text);
+
+            textBox->textEntered('x');
+            REQUIRE(textBox->getText() == "x");
+            REQUIRE(textBox->getLinesCount() == 1);
+            REQUIRE(textBox->getCaretPosition() == 1);
+        }
+
+        SECTION("Adding text")
+        {
+            textBox->addText("\nFourth");
+            REQUIRE(textBox->getText() == text + "\nFourth");
+            REQUIRE(textBox->getLinesCount() == linesCount + 1);
+            REQUIRE(textBox->getCaretPosition() == text.getSize() + 7);
+        }
+    }
+
+    SECTION("Only the visible lines are drawn")
+    {
+        sf::RenderTexture target;
+        target.create(400, 300);
+
+        tgui::Gui gui{target};
+        gui.setRenderStatisticsEnabled(true);
+        gui.add(textBox);
+
+        const auto countVertices = [&](std::size_t lineCount)
+            {
+                sf::String text = "Line";
+                for (std::size_t i = 1; i < lineCount; ++i)
+                    text += "\nLine";
+
+                textBox->setText(text);
+                REQUIRE(textBox->getLinesCount() == lineCount);
+
+                gui.draw();
+                return gui.getRenderStatistics().vertices;
+            };
+
+        const std::size_t vertices = countVertices(100);
+        REQUIRE(countVertices(10000) == vertices);
+
+        // Scrolling to the top only changes which lines are drawn
+        textBox->setCaretPosition(0);
+        gui.draw();
+        REQUIRE(gui.getRenderStatistics().vertices > 0);
+        REQUIRE(gui.getRenderStatistics().vertices < 2 * vertices);
+
+        // Selecting everything doesn't create geometry for the invisible lines either
+        sf::Event::KeyEvent event;
+        event.control = true;
+        event.alt     = false;
+        event.shift   = false;
+        event.system  = false;
+        event.code    = sf::Keyboard::A;
+        textBox->keyPressed(event);
+        REQUIRE(textBox->getSelectedText().getSize() == 10000 * 5 - 1);
+
+        gui.draw();
+        REQUIRE(gui.getRenderStatistics().vertices < 2 * vertices);
+    }
+
+    SECTION("Document")
+    {
+        {
+            std::ofstream file{"TextBoxDocument.txt"};
+            for (unsigned int i = 0; i < 10000; ++i)
+                file << "Line " << i << "\n";
+        }
+
+        REQUIRE(!textBox->openDocument("resources/NonExistentFile.txt"));
+        REQUIRE(!textBox->isDocumentOpen());
+
+        textBox->setText("Some text");
+        REQUIRE(textBox->openDocument("TextBoxDocument.txt"));
+        REQUIRE(textBox->isDocumentOpen());
+        REQUIRE(textBox->getText() == "");
+
+        // The document can't be edited
+        textBox->textEntered('a');
+        textBox->addText("b");
+        REQUIRE(textBox->getText() == "");
+
+        sf::RenderTexture target;
+        target.create(400, 300);
+
+        tgui::Gui gui{target};
+        gui.setRenderStatisticsEnabled(true);
+        gui.add(textBox);
+
+        // The lines are counted while the widget is updated
+        gui.updateTime({});
+        REQUIRE(textBox->getLinesCount() == 10001);
+
+        // Only the visible lines are drawn
+        gui.draw();
+        const std::size_t vertices = gui.getRenderStatistics().vertices;
+        REQUIRE(vertices > 0);
+
+        sf::Event::KeyEvent event;
+        event.control = false;
+        event.alt     = false;
+        event.shift   = false;
+        event.system  = false;
+        event.code    = sf::Keyboard::End;
+        textBox->keyPressed(event);
+
+        gui.draw();
+        REQUIRE(gui.getRenderStatistics().vertices > 0);
+        REQUIRE(gui.getRenderStatistics().vertices < 2 * vertices);
+
+        // The rows of a long line at the end of the file can be scrolled into view
+        {
+            std::ofstream file{"TextBoxDocumentWrapped.txt"};
+            for (unsigned int i = 0; i < 1000; ++i)
+                file << "\n";
+            for (unsigned int i = 0; i < 70; ++i)
+                file << "word ";
+        }
+
+        textBox->setSize(200, 200);
+        textBox->setTextSize(10);
+        REQUIRE(textBox->openDocument("TextBoxDocumentWrapped.txt"));
+        gui.updateTime({});
+        textBox->keyPressed(event);
+
+        target.clear();
+        gui.draw();
+        target.display();
+        const sf::Image image = target.getTexture().copyToImage();
+
+        // The long line takes more than half of the rows, so there has to be text in the middle of the text box
+        bool textFound = false;
+        for (unsigned int y = 90; y < 110; ++y)
+        {
+            for (unsigned int x = 10; x < 150; ++x)
+            {
+                if (image.getPixel(x, y).r < 128)
+                    textFound = true;
+            }
+        }
+        REQUIRE(textFound);
+
+        textBox->setText("Text");
+        REQUIRE(!textBox->isDocumentOpen());
+        REQUIRE(textBox->getText() == "Text");
+    }
+
     SECTION("ReadOnly")
     {
         SECTION("Changing the read-only state")